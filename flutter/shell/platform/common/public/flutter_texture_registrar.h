@@ -25,7 +25,14 @@ typedef enum {
   // A Pixel buffer-based texture.
   kFlutterDesktopPixelBufferTexture,
   // A platform-specific GPU surface-backed texture.
-  kFlutterDesktopGpuSurfaceTexture
+  kFlutterDesktopGpuSurfaceTexture,
+  // A texture backed by a pool of buffers that are allocated by the embedder
+  // and written by the client (Tizen only).
+  kFlutterDesktopPixelBufferPoolTexture,
+  // A pixel buffer-based texture whose buffers may also describe their row
+  // layout, dirty regions and format (Tizen only). Configured with a
+  // |FlutterDesktopPixelBufferTextureConfig|.
+  kFlutterDesktopExtendedPixelBufferTexture
 } FlutterDesktopTextureType;
 
 // Supported GPU surface types.
@@ -49,9 +56,23 @@ typedef enum {
   kFlutterDesktopPixelFormatRGBA8888,
   // Represents a 32-bit BGRA color format with 8 bits each for blue, green, red
   // and alpha.
-  kFlutterDesktopPixelFormatBGRA8888
+  kFlutterDesktopPixelFormatBGRA8888,
+  // Represents a YUV 4:2:0 format with a plane of 8-bit Y samples followed by
+  // a plane of interleaved 8-bit U and V samples. OpenGL ES renderer only.
+  kFlutterDesktopPixelFormatNV12,
+  // Represents a YUV 4:2:0 format with separate planes of 8-bit Y, U and V
+  // samples. OpenGL ES renderer only.
+  kFlutterDesktopPixelFormatI420
 } FlutterDesktopPixelFormat;
 
+// A rectangle in a pixel buffer, in pixels.
+typedef struct {
+  size_t left;
+  size_t top;
+  size_t width;
+  size_t height;
+} FlutterDesktopPixelBufferRect;
+
 // An image buffer object.
 typedef struct {
   // The pixel data buffer.
@@ -64,6 +85,43 @@ typedef struct {
   void (*release_callback)(void* release_context);
   // Opaque data passed to |release_callback|.
   void* release_context;
+  // The fields below are only read for
+  // |kFlutterDesktopExtendedPixelBufferTexture| textures. For
+  // |kFlutterDesktopPixelBufferTexture| textures they are treated as zero, so
+  // that buffers of the smaller legacy layout remain valid.
+  //
+  // The size of this struct. Must be sizeof(FlutterDesktopPixelBuffer) of the
+  // header the producer was built with. Fields that end beyond |struct_size|
+  // are treated as zero.
+  size_t struct_size;
+  // The number of bytes between the starts of consecutive rows, or 0 if the
+  // rows are tightly packed (|width| * 4 bytes). Must be a multiple of 4.
+  size_t row_bytes;
+  // Optional regions that changed since the previous buffer returned for the
+  // same texture. If |dirty_rects_count| is 0, or the size of the buffer has
+  // changed, the whole buffer is uploaded. Must stay valid as long as
+  // |buffer|.
+  const FlutterDesktopPixelBufferRect* dirty_rects;
+  // The number of elements in |dirty_rects|.
+  size_t dirty_rects_count;
+  // The format of |buffer|, or |kFlutterDesktopPixelFormatNone| for
+  // |kFlutterDesktopPixelFormatRGBA8888|.
+  //
+  // For YUV formats, |buffer| and |row_bytes| describe the Y plane, and
+  // |row_bytes| need not be a multiple of 4. The samples are converted to RGB
+  // on the GPU as BT.601 limited range. |dirty_rects| are ignored.
+  //
+  // YUV formats are only supported by the OpenGL ES (EGL) renderer. The
+  // Vulkan renderer rejects YUV buffers and leaves the texture unchanged, so
+  // producers that may run with it must supply RGBA8888 buffers.
+  FlutterDesktopPixelFormat format;
+  // The chroma planes of YUV formats: the UV plane of NV12 in the first
+  // element, or the U and V planes of I420. If the first element is null,
+  // the chroma planes are expected to follow the Y plane contiguously.
+  const uint8_t* chroma_planes[2];
+  // The number of bytes between the starts of consecutive rows of
+  // |chroma_planes|, or 0 for the row length implied by |row_bytes|.
+  size_t chroma_row_bytes[2];
 } FlutterDesktopPixelBuffer;
 
 // A GPU surface descriptor.
@@ -148,11 +206,27 @@ typedef struct {
   void* user_data;
 } FlutterDesktopGpuSurfaceTextureConfig;
 
+// An object used to configure pixel buffer pool textures.
+typedef struct {
+  // The size of this struct. Must be
+  // sizeof(FlutterDesktopPixelBufferPoolTextureConfig).
+  size_t struct_size;
+  // The width of the buffers in the pool.
+  size_t width;
+  // The height of the buffers in the pool.
+  size_t height;
+  // The pixel format of the buffers in the pool.
+  FlutterDesktopPixelFormat format;
+  // The number of buffers in the pool, or 0 for the default.
+  size_t buffer_count;
+} FlutterDesktopPixelBufferPoolTextureConfig;
+
 typedef struct {
   FlutterDesktopTextureType type;
   union {
     FlutterDesktopPixelBufferTextureConfig pixel_buffer_config;
     FlutterDesktopGpuSurfaceTextureConfig gpu_surface_config;
+    FlutterDesktopPixelBufferPoolTextureConfig pixel_buffer_pool_config;
   };
 } FlutterDesktopTextureInfo;
 
@@ -0,0 +1,82 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_stats_channel.h"
+
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/standard_method_codec.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr char kChannelName[] = "tizen/frame_stats";
+
+EncodableValue EncodeHistogram(const FlutterDesktopHistogram& histogram) {
+  EncodableList buckets;
+  for (uint64_t bucket : histogram.buckets) {
+    buckets.push_back(EncodableValue(static_cast<int64_t>(bucket)));
+  }
+  EncodableMap map;
+  map[EncodableValue("buckets")] = EncodableValue(buckets);
+  map[EncodableValue("count")] =
+      EncodableValue(static_cast<int64_t>(histogram.count));
+  map[EncodableValue("sumUs")] =
+      EncodableValue(static_cast<int64_t>(histogram.sum_us));
+  map[EncodableValue("maxUs")] =
+      EncodableValue(static_cast<int64_t>(histogram.max_us));
+  return EncodableValue(map);
+}
+
+}  // namespace
+
+FrameStatsChannel::FrameStatsChannel(BinaryMessenger* messenger,
+                                     FrameStats* frame_stats)
+    : frame_stats_(frame_stats) {
+  channel_ = std::make_unique<MethodChannel<EncodableValue>>(
+      messenger, kChannelName, &StandardMethodCodec::GetInstance());
+  channel_->SetMethodCallHandler(
+      [this](const MethodCall<EncodableValue>& call,
+             std::unique_ptr<MethodResult<EncodableValue>> result) {
+        this->HandleMethodCall(call, std::move(result));
+      });
+}
+
+FrameStatsChannel::~FrameStatsChannel() {}
+
+void FrameStatsChannel::HandleMethodCall(
+    const MethodCall<EncodableValue>& method_call,
+    std::unique_ptr<MethodResult<EncodableValue>> result) {
+  const std::string& method_name = method_call.method_name();
+
+  if (method_name == "getStats") {
+    FlutterDesktopFrameStats stats = {};
+    stats.struct_size = sizeof(FlutterDesktopFrameStats);
+    if (!frame_stats_->GetStats(&stats)) {
+      result->Error("Frame statistics are disabled");
+      return;
+    }
+    EncodableMap map;
+    map[EncodableValue("frameCount")] =
+        EncodableValue(static_cast<int64_t>(stats.frame_count));
+    map[EncodableValue("lateFrameCount")] =
+        EncodableValue(static_cast<int64_t>(stats.late_frame_count));
+    map[EncodableValue("droppedFrameCount")] =
+        EncodableValue(static_cast<int64_t>(stats.dropped_frame_count));
+    map[EncodableValue("vsyncToPresent")] =
+        EncodeHistogram(stats.vsync_to_present);
+    map[EncodableValue("presentDuration")] =
+        EncodeHistogram(stats.present_duration);
+    map[EncodableValue("frameInterval")] =
+        EncodeHistogram(stats.frame_interval);
+    map[EncodableValue("gpuTime")] = EncodeHistogram(stats.gpu_time);
+    result->Success(EncodableValue(map));
+  } else if (method_name == "reset") {
+    frame_stats_->Reset();
+    result->Success();
+  } else {
+    result->NotImplemented();
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,36 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FRAME_STATS_CHANNEL_H_
+#define EMBEDDER_FRAME_STATS_CHANNEL_H_
+
+#include <memory>
+
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/binary_messenger.h"
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/encodable_value.h"
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/method_channel.h"
+#include "flutter/shell/platform/tizen/frame_stats.h"
+
+namespace flutter {
+
+// Channel to read the frame statistics collected by the embedder.
+class FrameStatsChannel {
+ public:
+  explicit FrameStatsChannel(BinaryMessenger* messenger,
+                             FrameStats* frame_stats);
+  virtual ~FrameStatsChannel();
+
+ private:
+  void HandleMethodCall(const MethodCall<EncodableValue>& method_call,
+                        std::unique_ptr<MethodResult<EncodableValue>> result);
+
+  std::unique_ptr<MethodChannel<EncodableValue>> channel_;
+
+  // A reference to the frame statistics owned by the engine.
+  FrameStats* frame_stats_ = nullptr;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FRAME_STATS_CHANNEL_H_
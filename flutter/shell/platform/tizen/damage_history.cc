@@ -0,0 +1,52 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/damage_history.h"
+
+#include <algorithm>
+
+namespace flutter {
+
+void DamageHistory::AddFrame(const FlutterDamage& frame_damage) {
+  if (frame_damage.num_rects == 0) {
+    // Buffers drawn before this frame are out of date entirely.
+    frames_.clear();
+    return;
+  }
+  FlutterRect frame_rect = {};
+  for (size_t i = 0; i < frame_damage.num_rects; i++) {
+    frame_rect = Union(frame_rect, frame_damage.damage[i]);
+  }
+  frames_.push_front(frame_rect);
+  if (frames_.size() > kMaxBufferAge - 1) {
+    frames_.pop_back();
+  }
+}
+
+bool DamageHistory::GetExistingDamage(int buffer_age,
+                                      FlutterRect* existing_damage) const {
+  if (buffer_age <= 0 || static_cast<size_t>(buffer_age) > kMaxBufferAge ||
+      static_cast<size_t>(buffer_age - 1) > frames_.size()) {
+    return false;
+  }
+  FlutterRect rect = {};
+  for (int i = 0; i < buffer_age - 1; i++) {
+    rect = Union(rect, frames_[i]);
+  }
+  *existing_damage = rect;
+  return true;
+}
+
+FlutterRect DamageHistory::Union(const FlutterRect& a, const FlutterRect& b) {
+  if (IsEmpty(a)) {
+    return b;
+  }
+  if (IsEmpty(b)) {
+    return a;
+  }
+  return FlutterRect{std::min(a.left, b.left), std::min(a.top, b.top),
+                     std::max(a.right, b.right), std::max(a.bottom, b.bottom)};
+}
+
+}  // namespace flutter
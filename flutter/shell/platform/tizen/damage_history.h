@@ -0,0 +1,55 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_DAMAGE_HISTORY_H_
+#define EMBEDDER_DAMAGE_HISTORY_H_
+
+#include <cstddef>
+#include <deque>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
+namespace flutter {
+
+// Remembers the damage of recently presented frames so that the damage a
+// back buffer has accumulated since it was last drawn can be derived from its
+// buffer age (see EGL_EXT_buffer_age).
+class DamageHistory {
+ public:
+  // The oldest buffer age that can be served from the history. Older buffers
+  // are repainted entirely.
+  static constexpr size_t kMaxBufferAge = 4;
+
+  DamageHistory() = default;
+  ~DamageHistory() = default;
+
+  // Records the damage of a frame that is about to be presented. A frame
+  // without damage rectangles is considered to have changed entirely.
+  void AddFrame(const FlutterDamage& frame_damage);
+
+  // Computes the area of a buffer of the given |buffer_age| that is out of
+  // date, i.e. the union of the damage of the last |buffer_age - 1| frames.
+  // Returns false if the buffer has to be repainted entirely, which is the
+  // case when its age is unknown (0) or older than the history.
+  bool GetExistingDamage(int buffer_age, FlutterRect* existing_damage) const;
+
+  // Forgets all frames, e.g. when the buffers have been reallocated.
+  void Clear() { frames_.clear(); }
+
+  // Returns the smallest rectangle that contains both |a| and |b|. Empty
+  // rectangles are ignored.
+  static FlutterRect Union(const FlutterRect& a, const FlutterRect& b);
+
+  static bool IsEmpty(const FlutterRect& rect) {
+    return rect.left >= rect.right || rect.top >= rect.bottom;
+  }
+
+ private:
+  // The damage of the most recent frames, newest first.
+  std::deque<FlutterRect> frames_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_DAMAGE_HISTORY_H_
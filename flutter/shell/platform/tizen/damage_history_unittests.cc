@@ -0,0 +1,109 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/damage_history.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+void AddFrame(DamageHistory* history, FlutterRect rect) {
+  FlutterDamage damage = {sizeof(FlutterDamage), 1, &rect};
+  history->AddFrame(damage);
+}
+
+void ExpectRect(const FlutterRect& rect,
+                double left,
+                double top,
+                double right,
+                double bottom) {
+  EXPECT_EQ(rect.left, left);
+  EXPECT_EQ(rect.top, top);
+  EXPECT_EQ(rect.right, right);
+  EXPECT_EQ(rect.bottom, bottom);
+}
+
+}  // namespace
+
+TEST(DamageHistoryTest, UnknownBufferAgeNeedsFullRepaint) {
+  DamageHistory history;
+  AddFrame(&history, {0, 0, 10, 10});
+
+  FlutterRect rect;
+  EXPECT_FALSE(history.GetExistingDamage(0, &rect));
+}
+
+TEST(DamageHistoryTest, SameBufferHasNoExistingDamage) {
+  DamageHistory history;
+  AddFrame(&history, {0, 0, 10, 10});
+
+  FlutterRect rect;
+  ASSERT_TRUE(history.GetExistingDamage(1, &rect));
+  EXPECT_TRUE(DamageHistory::IsEmpty(rect));
+}
+
+TEST(DamageHistoryTest, AccumulatesDamageOfNewerFrames) {
+  DamageHistory history;
+  AddFrame(&history, {100, 100, 110, 110});
+  AddFrame(&history, {0, 0, 10, 10});
+  AddFrame(&history, {20, 30, 40, 50});
+
+  FlutterRect rect;
+  ASSERT_TRUE(history.GetExistingDamage(2, &rect));
+  ExpectRect(rect, 20, 30, 40, 50);
+  ASSERT_TRUE(history.GetExistingDamage(3, &rect));
+  ExpectRect(rect, 0, 0, 40, 50);
+  ASSERT_TRUE(history.GetExistingDamage(4, &rect));
+  ExpectRect(rect, 0, 0, 110, 110);
+}
+
+TEST(DamageHistoryTest, BuffersOlderThanHistoryNeedFullRepaint) {
+  DamageHistory history;
+  AddFrame(&history, {0, 0, 10, 10});
+
+  FlutterRect rect;
+  EXPECT_TRUE(history.GetExistingDamage(2, &rect));
+  EXPECT_FALSE(history.GetExistingDamage(3, &rect));
+
+  for (size_t i = 0; i < DamageHistory::kMaxBufferAge; i++) {
+    AddFrame(&history, {0, 0, 10, 10});
+  }
+  EXPECT_TRUE(history.GetExistingDamage(DamageHistory::kMaxBufferAge, &rect));
+  EXPECT_FALSE(
+      history.GetExistingDamage(DamageHistory::kMaxBufferAge + 1, &rect));
+
+  history.Clear();
+  EXPECT_FALSE(history.GetExistingDamage(2, &rect));
+}
+
+TEST(DamageHistoryTest, MergesMultipleRectsOfAFrame) {
+  DamageHistory history;
+  FlutterRect rects[] = {{0, 0, 10, 10}, {50, 60, 70, 80}};
+  FlutterDamage damage = {sizeof(FlutterDamage), 2, rects};
+  history.AddFrame(damage);
+
+  FlutterRect rect;
+  ASSERT_TRUE(history.GetExistingDamage(2, &rect));
+  ExpectRect(rect, 0, 0, 70, 80);
+}
+
+TEST(DamageHistoryTest, FrameWithoutRectsDamagesOlderBuffers) {
+  DamageHistory history;
+  AddFrame(&history, {0, 0, 10, 10});
+  AddFrame(&history, {0, 0, 10, 10});
+  FlutterDamage full_damage = {sizeof(FlutterDamage), 0, nullptr};
+  history.AddFrame(full_damage);
+  AddFrame(&history, {20, 20, 30, 30});
+
+  FlutterRect rect;
+  ASSERT_TRUE(history.GetExistingDamage(2, &rect));
+  ExpectRect(rect, 20, 20, 30, 30);
+  EXPECT_FALSE(history.GetExistingDamage(3, &rect));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -5,7 +5,10 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_H_
 #define EMBEDDER_EXTERNAL_TEXTURE_H_
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <cstring>
 #include <memory>
 
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
@@ -28,6 +31,29 @@ class ExternalTexture {
   const int64_t texture_id_ = 0;
 };
 
+// Copies the fields of |pixel_buffer| that the producer provides into |out|
+// and zeroes the others. The fields following |release_context| are only
+// provided by extended pixel buffers, as far as their |struct_size| covers
+// them. Returns false if the |struct_size| of an extended pixel buffer is
+// invalid.
+inline bool ReadPixelBuffer(const FlutterDesktopPixelBuffer& pixel_buffer,
+                            bool is_extended,
+                            FlutterDesktopPixelBuffer* out) {
+  constexpr size_t kLegacySize =
+      offsetof(FlutterDesktopPixelBuffer, struct_size);
+  *out = {};
+  if (!is_extended) {
+    memcpy(out, &pixel_buffer, kLegacySize);
+    return true;
+  }
+  if (pixel_buffer.struct_size < kLegacySize + sizeof(size_t)) {
+    return false;
+  }
+  memcpy(out, &pixel_buffer,
+         std::min(pixel_buffer.struct_size, sizeof(FlutterDesktopPixelBuffer)));
+  return true;
+}
+
 enum class ExternalTextureExtensionType { kNone, kNativeSurface, kDmaBuffer };
 
 struct ExternalTextureGLState {
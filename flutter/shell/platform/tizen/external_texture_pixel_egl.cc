@@ -9,12 +9,20 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
+#include <algorithm>
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
 namespace flutter {
 
 bool ExternalTexturePixelEGL::PopulateGLTexture(
     size_t width,
     size_t height,
     FlutterOpenGLTexture* opengl_texture) {
+  if (uploader_) {
+    return PopulateFromFrontBuffer(width, height, opengl_texture);
+  }
   if (!CopyPixelBuffer(width, height)) {
     return false;
   }
@@ -32,40 +40,337 @@ bool ExternalTexturePixelEGL::PopulateGLTexture(
 
 ExternalTexturePixelEGL::ExternalTexturePixelEGL(
     FlutterDesktopPixelBufferTextureCallback texture_callback,
-    void* user_data)
+    void* user_data,
+    bool is_extended,
+    std::shared_ptr<PixelBufferUploader> uploader)
     : ExternalGLTexture(),
       texture_callback_(texture_callback),
-      user_data_(user_data) {}
+      user_data_(user_data),
+      is_extended_(is_extended),
+      uploader_(std::move(uploader)) {}
+
+ExternalTexturePixelEGL::~ExternalTexturePixelEGL() {
+  if (uploader_) {
+    uploader_->CancelTasks(this);
+    for (Buffer& buffer : buffers_) {
+      uploader_->DestroyFence(buffer.upload_fence);
+      uploader_->DestroyFence(buffer.release_fence);
+      if (buffer.texture.name != 0) {
+        glDeleteTextures(1, &buffer.texture.name);
+      }
+    }
+  }
+  if (texture_.name != 0) {
+    glDeleteTextures(1, &texture_.name);
+  }
+}
 
 bool ExternalTexturePixelEGL::CopyPixelBuffer(size_t& width, size_t& height) {
   if (!texture_callback_) {
     return false;
   }
 
-  const FlutterDesktopPixelBuffer* pixel_buffer =
+  const FlutterDesktopPixelBuffer* producer_buffer =
       texture_callback_(width, height, user_data_);
+  FlutterDesktopPixelBuffer pixel_buffer;
+  if (!producer_buffer ||
+      !ReadPixelBuffer(*producer_buffer, is_extended_, &pixel_buffer) ||
+      !pixel_buffer.buffer) {
+    return false;
+  }
 
-  if (!pixel_buffer || !pixel_buffer->buffer) {
+  width = pixel_buffer.width;
+  height = pixel_buffer.height;
+
+  size_t row_bytes = GetRowBytes(pixel_buffer);
+  if (row_bytes == 0) {
     return false;
   }
+  UploadPixelBuffer(pixel_buffer, row_bytes, pixel_buffer.dirty_rects,
+                    pixel_buffer.dirty_rects_count, &texture_);
+  state_->gl_texture = texture_.name;
+  return true;
+}
 
-  width = pixel_buffer->width;
-  height = pixel_buffer->height;
+bool ExternalTexturePixelEGL::ScheduleUpload() {
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    if (upload_scheduled_) {
+      // The pending upload will read the latest buffer.
+      return true;
+    }
+    upload_scheduled_ = true;
+  }
+  if (!uploader_->PostTask(this, [this]() { UploadToBackBuffer(); })) {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    upload_scheduled_ = false;
+    return false;
+  }
+  return true;
+}
 
-  if (state_->gl_texture == 0) {
-    glGenTextures(1, static_cast<GLuint*>(&state_->gl_texture));
-    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(state_->gl_texture));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER_OES);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER_OES);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-  } else {
-    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(state_->gl_texture));
+void ExternalTexturePixelEGL::UploadToBackBuffer() {
+  int back_buffer;
+  size_t width, height;
+  EGLSyncKHR release_fence;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    upload_scheduled_ = false;
+    back_buffer = front_buffer_ == 0 ? 1 : 0;
+    if (ready_buffer_ == back_buffer) {
+      // Replaced by this upload.
+      ready_buffer_ = kNoBuffer;
+    }
+    release_fence = buffers_[back_buffer].release_fence;
+    buffers_[back_buffer].release_fence = EGL_NO_SYNC_KHR;
+    width = requested_width_;
+    height = requested_height_;
+  }
+  // Wait until the engine no longer reads the texture before overwriting it.
+  uploader_->WaitAndDestroyFence(release_fence);
+
+  const FlutterDesktopPixelBuffer* producer_buffer =
+      texture_callback_(width, height, user_data_);
+  FlutterDesktopPixelBuffer pixel_buffer;
+  if (!producer_buffer ||
+      !ReadPixelBuffer(*producer_buffer, is_extended_, &pixel_buffer) ||
+      !pixel_buffer.buffer) {
+    return;
+  }
+  size_t row_bytes = GetRowBytes(pixel_buffer);
+  if (row_bytes == 0) {
+    return;
+  }
+
+  // The back buffer misses the changes of the uploads made since it was
+  // last written.
+  Buffer& buffer = buffers_[back_buffer];
+  std::vector<FlutterDesktopPixelBufferRect> dirty_rects;
+  const bool is_yuv = YuvConverter::IsYuvFormat(pixel_buffer.format);
+  bool has_dirty_rects = !is_yuv && pixel_buffer.dirty_rects &&
+                         pixel_buffer.dirty_rects_count > 0;
+  if (has_dirty_rects && buffer.generation + 1 == upload_count_ &&
+      !last_dirty_rects_.empty()) {
+    dirty_rects = last_dirty_rects_;
+  } else if (buffer.generation != upload_count_) {
+    has_dirty_rects = false;
+  }
+  if (has_dirty_rects) {
+    dirty_rects.insert(
+        dirty_rects.end(), pixel_buffer.dirty_rects,
+        pixel_buffer.dirty_rects + pixel_buffer.dirty_rects_count);
+  }
+  UploadPixelBuffer(pixel_buffer, row_bytes,
+                    has_dirty_rects ? dirty_rects.data() : nullptr,
+                    dirty_rects.size(), &buffer.texture);
+
+  upload_count_++;
+  buffer.generation = upload_count_;
+  last_dirty_rects_.clear();
+  if (!is_yuv && pixel_buffer.dirty_rects) {
+    last_dirty_rects_.assign(
+        pixel_buffer.dirty_rects,
+        pixel_buffer.dirty_rects + pixel_buffer.dirty_rects_count);
+  }
+
+  EGLSyncKHR upload_fence = uploader_->CreateFence(true);
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    uploader_->DestroyFence(buffer.upload_fence);
+    buffer.upload_fence = upload_fence;
+    ready_buffer_ = back_buffer;
+  }
+  if (frame_uploaded_callback_) {
+    frame_uploaded_callback_();
+  }
+}
+
+bool ExternalTexturePixelEGL::PopulateFromFrontBuffer(
+    size_t width,
+    size_t height,
+    FlutterOpenGLTexture* opengl_texture) {
+  EGLSyncKHR upload_fence = EGL_NO_SYNC_KHR;
+  Texture texture;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    requested_width_ = width;
+    requested_height_ = height;
+    if (ready_buffer_ != kNoBuffer) {
+      if (front_buffer_ != kNoBuffer) {
+        // The fence is flushed together with the current frame.
+        Buffer& old_front = buffers_[front_buffer_];
+        uploader_->DestroyFence(old_front.release_fence);
+        old_front.release_fence = uploader_->CreateFence(false);
+      }
+      front_buffer_ = ready_buffer_;
+      ready_buffer_ = kNoBuffer;
+      upload_fence = buffers_[front_buffer_].upload_fence;
+      buffers_[front_buffer_].upload_fence = EGL_NO_SYNC_KHR;
+    }
+    if (front_buffer_ != kNoBuffer) {
+      texture = buffers_[front_buffer_].texture;
+    }
   }
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixel_buffer->width,
-               pixel_buffer->height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-               pixel_buffer->buffer);
+  if (texture.name == 0) {
+    // Nothing has been uploaded yet. The engine is notified once the first
+    // frame is ready.
+    ScheduleUpload();
+    return false;
+  }
+  uploader_->WaitAndDestroyFence(upload_fence);
+
+  opengl_texture->target = GL_TEXTURE_2D;
+  opengl_texture->name = texture.name;
+  opengl_texture->format = GL_RGBA8_OES;
+  opengl_texture->destruction_callback = nullptr;
+  opengl_texture->user_data = nullptr;
+  opengl_texture->width = texture.width;
+  opengl_texture->height = texture.height;
   return true;
 }
 
+size_t ExternalTexturePixelEGL::GetRowBytes(
+    const FlutterDesktopPixelBuffer& pixel_buffer) {
+  if (YuvConverter::IsYuvFormat(pixel_buffer.format)) {
+    if (pixel_buffer.row_bytes == 0) {
+      return pixel_buffer.width;
+    }
+    if (pixel_buffer.row_bytes < pixel_buffer.width) {
+      FT_LOG(Error) << "Invalid row bytes " << pixel_buffer.row_bytes
+                    << " for a YUV pixel buffer of width "
+                    << pixel_buffer.width << ".";
+      return 0;
+    }
+    return pixel_buffer.row_bytes;
+  }
+  if (pixel_buffer.format != kFlutterDesktopPixelFormatNone &&
+      pixel_buffer.format != kFlutterDesktopPixelFormatRGBA8888) {
+    FT_LOG(Error) << "Unsupported pixel buffer format: "
+                  << pixel_buffer.format;
+    return 0;
+  }
+  size_t row_bytes = pixel_buffer.row_bytes;
+  if (row_bytes == 0) {
+    return pixel_buffer.width * 4;
+  }
+  if (row_bytes < pixel_buffer.width * 4 || row_bytes % 4 != 0) {
+    FT_LOG(Error) << "Invalid row bytes " << row_bytes << " for a pixel buffer "
+                  << "of width " << pixel_buffer.width << ".";
+    return 0;
+  }
+  return row_bytes;
+}
+
+void ExternalTexturePixelEGL::CheckExtensions() {
+  if (extensions_checked_) {
+    return;
+  }
+  extensions_checked_ = true;
+  const char* extensions =
+      reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+  if (extensions && strstr(extensions, "GL_EXT_texture_storage")) {
+    tex_storage_2d_ = reinterpret_cast<PFNGLTEXSTORAGE2DEXTPROC>(
+        eglGetProcAddress("glTexStorage2DEXT"));
+  }
+  has_unpack_subimage_ =
+      extensions && strstr(extensions, "GL_EXT_unpack_subimage");
+}
+
+void ExternalTexturePixelEGL::UploadPixelBuffer(
+    const FlutterDesktopPixelBuffer& pixel_buffer,
+    size_t row_bytes,
+    const FlutterDesktopPixelBufferRect* dirty_rects,
+    size_t dirty_rects_count,
+    Texture* texture) {
+  CheckExtensions();
+
+  const size_t width = pixel_buffer.width;
+  const size_t height = pixel_buffer.height;
+  const FlutterDesktopPixelBufferRect full_rect = {0, 0, width, height};
+  if (YuvConverter::IsYuvFormat(pixel_buffer.format)) {
+    if (texture->name == 0 || width != texture->width ||
+        height != texture->height) {
+      AllocateTexture(texture, width, height);
+    }
+    if (!yuv_converter_) {
+      yuv_converter_ = std::make_unique<YuvConverter>(has_unpack_subimage_);
+    }
+    yuv_converter_->Convert(pixel_buffer, row_bytes, texture->name);
+    return;
+  }
+  if (texture->name == 0 || width != texture->width ||
+      height != texture->height) {
+    AllocateTexture(texture, width, height);
+    UploadRect(pixel_buffer.buffer, row_bytes, full_rect);
+    return;
+  }
+
+  glBindTexture(GL_TEXTURE_2D, texture->name);
+  if (!dirty_rects || dirty_rects_count == 0) {
+    UploadRect(pixel_buffer.buffer, row_bytes, full_rect);
+    return;
+  }
+  for (size_t i = 0; i < dirty_rects_count; i++) {
+    FlutterDesktopPixelBufferRect rect = dirty_rects[i];
+    if (rect.left >= width || rect.top >= height) {
+      continue;
+    }
+    rect.width = std::min(rect.width, width - rect.left);
+    rect.height = std::min(rect.height, height - rect.top);
+    if (rect.width > 0 && rect.height > 0) {
+      UploadRect(pixel_buffer.buffer, row_bytes, rect);
+    }
+  }
+}
+
+void ExternalTexturePixelEGL::AllocateTexture(Texture* texture,
+                                              size_t width,
+                                              size_t height) {
+  // Immutable storage cannot be resized.
+  if (texture->name != 0) {
+    glDeleteTextures(1, &texture->name);
+  }
+  glGenTextures(1, &texture->name);
+  glBindTexture(GL_TEXTURE_2D, texture->name);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER_OES);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER_OES);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  if (tex_storage_2d_) {
+    tex_storage_2d_(GL_TEXTURE_2D, 1, GL_RGBA8_OES, width, height);
+  } else {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+  }
+  texture->width = width;
+  texture->height = height;
+}
+
+void ExternalTexturePixelEGL::UploadRect(
+    const uint8_t* buffer,
+    size_t row_bytes,
+    const FlutterDesktopPixelBufferRect& rect) {
+  const uint8_t* origin = buffer + rect.top * row_bytes + rect.left * 4;
+  const size_t rect_row_bytes = rect.width * 4;
+
+  if (row_bytes == rect_row_bytes) {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect.left, rect.top, rect.width,
+                    rect.height, GL_RGBA, GL_UNSIGNED_BYTE, origin);
+  } else if (has_unpack_subimage_) {
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, row_bytes / 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect.left, rect.top, rect.width,
+                    rect.height, GL_RGBA, GL_UNSIGNED_BYTE, origin);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);
+  } else {
+    staging_buffer_.resize(rect_row_bytes * rect.height);
+    for (size_t row = 0; row < rect.height; row++) {
+      memcpy(staging_buffer_.data() + row * rect_row_bytes,
+             origin + row * row_bytes, rect_row_bytes);
+    }
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect.left, rect.top, rect.width,
+                    rect.height, GL_RGBA, GL_UNSIGNED_BYTE,
+                    staging_buffer_.data());
+  }
+}
+
 }  // namespace flutter
@@ -5,19 +5,42 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_H
 #define EMBEDDER_EXTERNAL_TEXTURE_PIXEL_EGL_H
 
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/pixel_buffer_uploader.h"
+#include "flutter/shell/platform/tizen/yuv_converter.h"
 
 namespace flutter {
 
 class ExternalTexturePixelEGL : public ExternalGLTexture {
  public:
+  // If |is_extended| is true, the producer returns extended pixel buffers
+  // (see |kFlutterDesktopExtendedPixelBufferTexture|).
+  //
+  // If |uploader| is not null, pixel buffers are uploaded on its thread into
+  // a pair of textures, and the raster thread only binds the texture that
+  // was uploaded last. Otherwise they are uploaded when the engine asks for
+  // the texture.
   ExternalTexturePixelEGL(
       FlutterDesktopPixelBufferTextureCallback texture_callback,
-      void* user_data);
+      void* user_data,
+      bool is_extended,
+      std::shared_ptr<PixelBufferUploader> uploader = nullptr);
 
-  ~ExternalTexturePixelEGL() = default;
+  ~ExternalTexturePixelEGL();
 
   bool PopulateGLTexture(size_t width,
                          size_t height,
@@ -25,9 +48,117 @@ class ExternalTexturePixelEGL : public ExternalGLTexture {
 
   bool CopyPixelBuffer(size_t& width, size_t& height);
 
+  bool IsAsync() const { return uploader_ != nullptr; }
+
+  // Sets the callback invoked on the upload thread when a new frame has been
+  // uploaded and can be shown.
+  void SetFrameUploadedCallback(std::function<void()> callback) {
+    frame_uploaded_callback_ = std::move(callback);
+  }
+
+  // Schedules an upload of the producer's current pixel buffer, unless one
+  // is already pending. Returns false if the upload thread has stopped.
+  bool ScheduleUpload();
+
  private:
+  // The storage of a texture.
+  struct Texture {
+    GLuint name = 0;
+    size_t width = 0;
+    size_t height = 0;
+  };
+
+  // A texture of the pair used for asynchronous uploads.
+  struct Buffer {
+    Texture texture;
+    // Signaled when the upload into |texture| has completed.
+    EGLSyncKHR upload_fence = EGL_NO_SYNC_KHR;
+    // Signaled when the engine's reads of |texture| have completed.
+    EGLSyncKHR release_fence = EGL_NO_SYNC_KHR;
+    // The number of the upload that last wrote |texture|, or 0.
+    uint64_t generation = 0;
+  };
+
+  static constexpr int kNoBuffer = -1;
+
+  // Returns the distance between rows of |pixel_buffer| in bytes, or 0 if it
+  // is invalid. For YUV formats, this is the distance between rows of the Y
+  // plane.
+  static size_t GetRowBytes(const FlutterDesktopPixelBuffer& pixel_buffer);
+
+  // Resolves the GL extensions used for uploads with the uploading context
+  // current.
+  void CheckExtensions();
+
+  // Uploads |pixel_buffer| into |texture|, reallocating it if the size has
+  // changed. Otherwise, only |dirty_rects| are uploaded if not null. YUV
+  // buffers are converted to RGBA and always uploaded whole.
+  void UploadPixelBuffer(const FlutterDesktopPixelBuffer& pixel_buffer,
+                         size_t row_bytes,
+                         const FlutterDesktopPixelBufferRect* dirty_rects,
+                         size_t dirty_rects_count,
+                         Texture* texture);
+
+  // Creates a texture with storage for |width| x |height| pixels, replacing
+  // |texture|.
+  void AllocateTexture(Texture* texture, size_t width, size_t height);
+
+  // Uploads the |rect| region of |buffer|, whose rows are |row_bytes| apart,
+  // into the bound texture.
+  void UploadRect(const uint8_t* buffer,
+                  size_t row_bytes,
+                  const FlutterDesktopPixelBufferRect& rect);
+
+  // Uploads the current pixel buffer into the back texture. Called on the
+  // upload thread.
+  void UploadToBackBuffer();
+
+  bool PopulateFromFrontBuffer(size_t width,
+                               size_t height,
+                               FlutterOpenGLTexture* opengl_texture);
+
   FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
   void* user_data_ = nullptr;
+  // Whether the producer returns extended pixel buffers.
+  bool is_extended_ = false;
+
+  // Resolved on the first upload, with the uploading context current.
+  bool extensions_checked_ = false;
+  PFNGLTEXSTORAGE2DEXTPROC tex_storage_2d_ = nullptr;
+  bool has_unpack_subimage_ = false;
+
+  // The texture of synchronous uploads.
+  Texture texture_;
+
+  // Rows of a region repacked for upload if GL_EXT_unpack_subimage is not
+  // supported.
+  std::vector<uint8_t> staging_buffer_;
+
+  // Created on the first YUV upload, with the uploading context current.
+  std::unique_ptr<YuvConverter> yuv_converter_;
+
+  std::shared_ptr<PixelBufferUploader> uploader_;
+  std::function<void()> frame_uploaded_callback_;
+
+  // The state of asynchronous uploads, guarded by |buffers_mutex_|. The back
+  // buffer, i.e. the one that is not |front_buffer_|, is only written on the
+  // upload thread.
+  std::array<Buffer, 2> buffers_;
+  // The buffer shown by the engine.
+  int front_buffer_ = kNoBuffer;
+  // The buffer that has been uploaded but not shown yet.
+  int ready_buffer_ = kNoBuffer;
+  bool upload_scheduled_ = false;
+  // The size last requested by the engine.
+  size_t requested_width_ = 0;
+  size_t requested_height_ = 0;
+  std::mutex buffers_mutex_;
+
+  // Only accessed on the upload thread.
+  uint64_t upload_count_ = 0;
+  // The dirty rectangles of the last upload, needed to bring the other
+  // buffer up to date. Empty if the whole buffer changed.
+  std::vector<FlutterDesktopPixelBufferRect> last_dirty_rects_;
 };
 
 }  // namespace flutter
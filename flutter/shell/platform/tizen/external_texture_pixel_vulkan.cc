@@ -9,15 +9,22 @@ namespace flutter {
 ExternalTexturePixelVulkan::ExternalTexturePixelVulkan(
     FlutterDesktopPixelBufferTextureCallback texture_callback,
     void* user_data,
+    bool is_extended,
     TizenRendererVulkan* vulkan_renderer)
     : ExternalVulkanTexture(),
       texture_callback_(texture_callback),
       user_data_(user_data),
+      is_extended_(is_extended),
       vulkan_renderer_(vulkan_renderer) {}
 
 ExternalTexturePixelVulkan::~ExternalTexturePixelVulkan() {
-  ReleaseBuffer();
-  ReleaseImage();
+  for (Slot& slot : slots_) {
+    if (slot.upload_serial != 0) {
+      vulkan_renderer_->WaitForTransfer(slot.upload_serial);
+    }
+    ReleaseBuffer(&slot);
+    ReleaseImage(&slot);
+  }
 }
 
 bool ExternalTexturePixelVulkan::PopulateVulkanTexture(
@@ -29,88 +36,127 @@ bool ExternalTexturePixelVulkan::PopulateVulkanTexture(
     return false;
   }
 
-  const FlutterDesktopPixelBuffer* pixel_buffer =
+  const FlutterDesktopPixelBuffer* producer_buffer =
       texture_callback_(width, height, user_data_);
 
-  if (!pixel_buffer) {
+  if (!producer_buffer) {
     FT_LOG(Error) << "pixel_buffer is nullptr";
     return false;
   }
 
-  if (!pixel_buffer->buffer) {
+  FlutterDesktopPixelBuffer pixel_buffer;
+  if (!ReadPixelBuffer(*producer_buffer, is_extended_, &pixel_buffer)) {
+    FT_LOG(Error) << "Invalid pixel buffer struct size: "
+                  << producer_buffer->struct_size;
+    return false;
+  }
+
+  if (!pixel_buffer.buffer) {
     FT_LOG(Error) << "pixel_buffer->buffer is nullptr";
     return false;
   }
 
-  if (pixel_buffer->width == 0 || pixel_buffer->height == 0) {
-    FT_LOG(Error) << "Invalid pixel buffer dimensions: " << pixel_buffer->width
-                  << "x" << pixel_buffer->height;
+  if (pixel_buffer.width == 0 || pixel_buffer.height == 0) {
+    FT_LOG(Error) << "Invalid pixel buffer dimensions: " << pixel_buffer.width
+                  << "x" << pixel_buffer.height;
+    return false;
+  }
+
+  // YUV formats are not supported by the Vulkan renderer.
+  if (pixel_buffer.format != kFlutterDesktopPixelFormatNone &&
+      pixel_buffer.format != kFlutterDesktopPixelFormatRGBA8888) {
+    FT_LOG(Error) << "Unsupported pixel buffer format for the Vulkan "
+                  << "renderer: " << pixel_buffer.format;
     return false;
   }
 
-  if (!CreateOrUpdateImage(pixel_buffer->width, pixel_buffer->height)) {
+  Slot* slot = &slots_[next_slot_];
+  // The copy of two frames ago is normally complete by now, but its staging
+  // buffer must not be overwritten before it is.
+  if (slot->upload_serial != 0) {
+    vulkan_renderer_->WaitForTransfer(slot->upload_serial);
+    slot->upload_serial = 0;
+  }
+
+  if (!CreateOrUpdateImage(slot, pixel_buffer.width, pixel_buffer.height)) {
     FT_LOG(Error) << "Fail to create image";
-    ReleaseImage();
+    ReleaseImage(slot);
+    return false;
+  }
+
+  size_t row_bytes = pixel_buffer.row_bytes;
+  if (row_bytes == 0) {
+    row_bytes = pixel_buffer.width * 4;
+  } else if (row_bytes < pixel_buffer.width * 4 || row_bytes % 4 != 0) {
+    FT_LOG(Error) << "Invalid row bytes " << row_bytes << " for a pixel buffer "
+                  << "of width " << pixel_buffer.width << ".";
     return false;
   }
 
+  // The rows are copied with their padding, except after the last row. Dirty
+  // rectangles are not used because each slot misses the updates made to
+  // the other.
   VkDeviceSize required_staging_size =
-      static_cast<VkDeviceSize>(pixel_buffer->width) *
-      static_cast<VkDeviceSize>(pixel_buffer->height) * 4;
-  if (!CreateOrUpdateBuffer(required_staging_size)) {
+      static_cast<VkDeviceSize>(row_bytes) * (pixel_buffer.height - 1) +
+      static_cast<VkDeviceSize>(pixel_buffer.width) * 4;
+  if (!CreateOrUpdateBuffer(slot, required_staging_size)) {
     FT_LOG(Error) << "Fail to create buffer";
-    ReleaseBuffer();
+    ReleaseBuffer(slot);
     return false;
   }
 
-  width_ = pixel_buffer->width;
-  height_ = pixel_buffer->height;
+  slot->width = pixel_buffer.width;
+  slot->height = pixel_buffer.height;
 
-  if (!CopyBufferToImage(pixel_buffer->buffer, required_staging_size)) {
+  if (!CopyBufferToImage(slot, pixel_buffer.buffer, required_staging_size,
+                         static_cast<uint32_t>(row_bytes / 4))) {
     FT_LOG(Error) << "Failed to copy buffer to image";
-    ReleaseBuffer();
-    ReleaseImage();
-    width_ = 0;
-    height_ = 0;
+    ReleaseBuffer(slot);
+    ReleaseImage(slot);
     return false;
   }
+  next_slot_ = (next_slot_ + 1) % kSlotCount;
 
   FlutterVulkanTexture* vulkan_texture =
       static_cast<FlutterVulkanTexture*>(flutter_texture);
-  vulkan_texture->image = reinterpret_cast<uint64_t>(image_);
+  vulkan_texture->image = reinterpret_cast<uint64_t>(slot->image);
   vulkan_texture->format = VK_FORMAT_R8G8B8A8_UNORM;
-  vulkan_texture->width = width_;
-  vulkan_texture->height = height_;
+  vulkan_texture->width = slot->width;
+  vulkan_texture->height = slot->height;
   return true;
 }
 
 bool ExternalTexturePixelVulkan::CreateOrUpdateBuffer(
+    Slot* slot,
     VkDeviceSize required_size) {
-  if (staging_buffer_ == VK_NULL_HANDLE) {
-    return CreateBuffer(required_size);
+  if (slot->staging_buffer == VK_NULL_HANDLE) {
+    return CreateBuffer(slot, required_size);
   }
 
-  if (required_size > staging_buffer_size_) {
-    ReleaseBuffer();
-    return CreateBuffer(required_size);
+  if (required_size > slot->staging_buffer_size) {
+    ReleaseBuffer(slot);
+    return CreateBuffer(slot, required_size);
   }
   return true;
 }
 
-bool ExternalTexturePixelVulkan::CreateOrUpdateImage(size_t width,
+bool ExternalTexturePixelVulkan::CreateOrUpdateImage(Slot* slot,
+                                                     size_t width,
                                                      size_t height) {
-  if (image_ == VK_NULL_HANDLE) {
-    return CreateImage(width, height);
+  if (slot->image == VK_NULL_HANDLE) {
+    return CreateImage(slot, width, height);
   }
 
-  if (width != width_ || height != height_) {
-    ReleaseImage();
-    return CreateImage(width, height);
+  if (width != slot->width || height != slot->height) {
+    ReleaseImage(slot);
+    return CreateImage(slot, width, height);
   }
   return true;
 }
 
-bool ExternalTexturePixelVulkan::CreateImage(size_t width, size_t height) {
+bool ExternalTexturePixelVulkan::CreateImage(Slot* slot,
+                                             size_t width,
+                                             size_t height) {
   VkImageCreateInfo image_info{};
   image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
   image_info.imageType = VK_IMAGE_TYPE_2D;
@@ -126,83 +172,89 @@ bool ExternalTexturePixelVulkan::CreateImage(size_t width, size_t height) {
       VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
   image_info.samples = VK_SAMPLE_COUNT_1_BIT;
   image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-  if (vkCreateImage(GetDevice(), &image_info, nullptr, &image_) != VK_SUCCESS) {
+  if (vkCreateImage(GetDevice(), &image_info, nullptr, &slot->image) !=
+      VK_SUCCESS) {
     FT_LOG(Error) << "Fail to create VkImage";
     return false;
   }
   VkMemoryRequirements memory_requirements;
-  vkGetImageMemoryRequirements(GetDevice(), image_, &memory_requirements);
+  vkGetImageMemoryRequirements(GetDevice(), slot->image,
+                               &memory_requirements);
 
-  if (!AllocateMemory(memory_requirements, &image_memory_,
+  if (!AllocateMemory(memory_requirements, &slot->image_memory,
                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
     FT_LOG(Error) << "Fail to allocate image memory";
     return false;
   }
 
-  if (vkBindImageMemory(GetDevice(), image_, image_memory_, 0) != VK_SUCCESS) {
+  if (vkBindImageMemory(GetDevice(), slot->image, slot->image_memory, 0) !=
+      VK_SUCCESS) {
     FT_LOG(Error) << "Fail to bind image memory";
     return false;
   }
   return true;
 }
 
-bool ExternalTexturePixelVulkan::CreateBuffer(VkDeviceSize required_size) {
+bool ExternalTexturePixelVulkan::CreateBuffer(Slot* slot,
+                                              VkDeviceSize required_size) {
   VkBufferCreateInfo buffer_info{};
   buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
   buffer_info.size = required_size;
   buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
   buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-  if (vkCreateBuffer(GetDevice(), &buffer_info, nullptr, &staging_buffer_) !=
-      VK_SUCCESS) {
+  if (vkCreateBuffer(GetDevice(), &buffer_info, nullptr,
+                     &slot->staging_buffer) != VK_SUCCESS) {
     FT_LOG(Error) << "Fail to create vkBuffer";
     return false;
   }
 
   VkMemoryRequirements memory_requirements;
-  vkGetBufferMemoryRequirements(GetDevice(), staging_buffer_,
+  vkGetBufferMemoryRequirements(GetDevice(), slot->staging_buffer,
                                 &memory_requirements);
 
-  if (!AllocateMemory(memory_requirements, &staging_buffer_memory_,
+  if (!AllocateMemory(memory_requirements, &slot->staging_buffer_memory,
                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
                           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
     FT_LOG(Error) << "Fail to allocate buffer memory";
     return false;
   }
 
-  if (vkBindBufferMemory(GetDevice(), staging_buffer_, staging_buffer_memory_,
-                         0) != VK_SUCCESS) {
+  if (vkBindBufferMemory(GetDevice(), slot->staging_buffer,
+                         slot->staging_buffer_memory, 0) != VK_SUCCESS) {
     FT_LOG(Error) << "Fail to bind buffer memory";
     return false;
   }
-  staging_buffer_size_ = required_size;
+  slot->staging_buffer_size = required_size;
   return true;
 }
 
-void ExternalTexturePixelVulkan::ReleaseBuffer() {
-  if (staging_buffer_ != VK_NULL_HANDLE) {
-    vkDestroyBuffer(GetDevice(), staging_buffer_, nullptr);
-    staging_buffer_ = VK_NULL_HANDLE;
+void ExternalTexturePixelVulkan::ReleaseBuffer(Slot* slot) {
+  if (slot->staging_buffer != VK_NULL_HANDLE) {
+    vkDestroyBuffer(GetDevice(), slot->staging_buffer, nullptr);
+    slot->staging_buffer = VK_NULL_HANDLE;
   }
-  if (staging_buffer_memory_ != VK_NULL_HANDLE) {
-    vkFreeMemory(GetDevice(), staging_buffer_memory_, nullptr);
+  if (slot->staging_buffer_memory != VK_NULL_HANDLE) {
+    vkFreeMemory(GetDevice(), slot->staging_buffer_memory, nullptr);
 
-    staging_buffer_memory_ = VK_NULL_HANDLE;
+    slot->staging_buffer_memory = VK_NULL_HANDLE;
   }
-  staging_buffer_size_ = 0;
+  slot->staging_buffer_size = 0;
 }
 
-bool ExternalTexturePixelVulkan::CopyBufferToImage(const uint8_t* src_buffer,
-                                                   VkDeviceSize size) {
+bool ExternalTexturePixelVulkan::CopyBufferToImage(Slot* slot,
+                                                   const uint8_t* src_buffer,
+                                                   VkDeviceSize size,
+                                                   uint32_t row_length) {
   void* data;
-  VkResult result =
-      vkMapMemory(GetDevice(), staging_buffer_memory_, 0, size, 0, &data);
+  VkResult result = vkMapMemory(GetDevice(), slot->staging_buffer_memory, 0,
+                                size, 0, &data);
   if (result != VK_SUCCESS) {
     FT_LOG(Error) << "Failed to map staging buffer memory";
     return false;
   }
   memcpy(data, src_buffer, static_cast<size_t>(size));
-  vkUnmapMemory(GetDevice(), staging_buffer_memory_);
+  vkUnmapMemory(GetDevice(), slot->staging_buffer_memory);
 
   VkCommandBuffer command_buffer = vulkan_renderer_->BeginSingleTimeCommands();
   if (command_buffer == VK_NULL_HANDLE) {
@@ -215,33 +267,50 @@ bool ExternalTexturePixelVulkan::CopyBufferToImage(const uint8_t* src_buffer,
 
   VkBufferImageCopy region{};
   region.bufferOffset = 0;
-  region.bufferRowLength = 0;
+  region.bufferRowLength = row_length;
   region.bufferImageHeight = 0;
   region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
   region.imageSubresource.mipLevel = 0;
   region.imageSubresource.baseArrayLayer = 0;
   region.imageSubresource.layerCount = 1;
   region.imageOffset = {0, 0, 0};
-  region.imageExtent = {static_cast<uint32_t>(width_),
-                        static_cast<uint32_t>(height_), 1};
-
-  vkCmdCopyBufferToImage(command_buffer, staging_buffer_, image_,
+  region.imageExtent = {static_cast<uint32_t>(slot->width),
+                        static_cast<uint32_t>(slot->height), 1};
+
+  // The copy is not waited for. Instead, barriers order it after earlier
+  // reads of the image and before the engine's rendering, which is submitted
+  // later to the same queue.
+  VkMemoryBarrier barrier{};
+  barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+  barrier.srcAccessMask = 0;
+  barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                       nullptr, 0, nullptr);
+
+  vkCmdCopyBufferToImage(command_buffer, slot->staging_buffer, slot->image,
                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 
-  vulkan_renderer_->EndSingleTimeCommands(command_buffer);
-  return true;
-}
+  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_MEMORY_READ_BIT;
+  vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0,
+                       nullptr, 0, nullptr);
 
-void ExternalTexturePixelVulkan::ReleaseImage() {
-  if (image_ != VK_NULL_HANDLE) {
-    vkDestroyImage(GetDevice(), image_, nullptr);
-    image_ = VK_NULL_HANDLE;
-  }
+  slot->upload_serial = vulkan_renderer_->SubmitTransfer(command_buffer);
+  return slot->upload_serial != 0;
+}
 
-  if (image_memory_ != VK_NULL_HANDLE) {
-    vkFreeMemory(GetDevice(), image_memory_, nullptr);
-    image_memory_ = VK_NULL_HANDLE;
+void ExternalTexturePixelVulkan::ReleaseImage(Slot* slot) {
+  // The image may still be sampled by frames in flight, so its destruction
+  // is deferred until they have finished.
+  if (slot->image != VK_NULL_HANDLE || slot->image_memory != VK_NULL_HANDLE) {
+    vulkan_renderer_->RetireImage(slot->image, slot->image_memory);
+    slot->image = VK_NULL_HANDLE;
+    slot->image_memory = VK_NULL_HANDLE;
   }
+  slot->width = 0;
+  slot->height = 0;
 }
 
 bool ExternalTexturePixelVulkan::AllocateMemory(
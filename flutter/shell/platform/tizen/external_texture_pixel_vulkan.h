@@ -13,9 +13,12 @@
 namespace flutter {
 class ExternalTexturePixelVulkan : public ExternalVulkanTexture {
  public:
+  // If |is_extended| is true, the producer returns extended pixel buffers
+  // (see |kFlutterDesktopExtendedPixelBufferTexture|).
   ExternalTexturePixelVulkan(
       FlutterDesktopPixelBufferTextureCallback texture_callback,
       void* user_data,
+      bool is_extended,
       TizenRendererVulkan* vulkan_renderer);
 
   virtual ~ExternalTexturePixelVulkan();
@@ -25,27 +28,45 @@ class ExternalTexturePixelVulkan : public ExternalVulkanTexture {
                              FlutterVulkanTexture* flutter_texture) override;
 
  private:
+  // Uploads alternate between two images, so that a frame can be copied
+  // while the previous one is still being sampled.
+  static constexpr size_t kSlotCount = 2;
+
+  struct Slot {
+    VkImage image = VK_NULL_HANDLE;
+    VkDeviceMemory image_memory = VK_NULL_HANDLE;
+    VkBuffer staging_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory staging_buffer_memory = VK_NULL_HANDLE;
+    VkDeviceSize staging_buffer_size = 0;
+    size_t width = 0;
+    size_t height = 0;
+    // The submission that copies the staging buffer into the image, or 0.
+    uint64_t upload_serial = 0;
+  };
+
   bool AllocateMemory(const VkMemoryRequirements& memory_requirements,
                       VkDeviceMemory* memory,
                       VkMemoryPropertyFlags properties);
-  bool CreateBuffer(VkDeviceSize required_size);
-  bool CreateImage(size_t width, size_t height);
-  bool CreateOrUpdateBuffer(VkDeviceSize required_size);
-  bool CreateOrUpdateImage(size_t width, size_t height);
-  bool CopyBufferToImage(const uint8_t* src_buffer, VkDeviceSize size);
+  bool CreateBuffer(Slot* slot, VkDeviceSize required_size);
+  bool CreateImage(Slot* slot, size_t width, size_t height);
+  bool CreateOrUpdateBuffer(Slot* slot, VkDeviceSize required_size);
+  bool CreateOrUpdateImage(Slot* slot, size_t width, size_t height);
+  // |row_length| is the distance between rows of |src_buffer| in pixels.
+  bool CopyBufferToImage(Slot* slot,
+                         const uint8_t* src_buffer,
+                         VkDeviceSize size,
+                         uint32_t row_length);
   VkDevice GetDevice() const;
-  void ReleaseBuffer();
-  void ReleaseImage();
+  void ReleaseBuffer(Slot* slot);
+  void ReleaseImage(Slot* slot);
   FlutterDesktopPixelBufferTextureCallback texture_callback_ = nullptr;
-  size_t width_ = 0;
-  size_t height_ = 0;
   void* user_data_ = nullptr;
+  // Whether the producer returns extended pixel buffers.
+  bool is_extended_ = false;
   TizenRendererVulkan* vulkan_renderer_ = nullptr;
-  VkImage image_ = VK_NULL_HANDLE;
-  VkDeviceMemory image_memory_ = VK_NULL_HANDLE;
-  VkBuffer staging_buffer_ = VK_NULL_HANDLE;
-  VkDeviceMemory staging_buffer_memory_ = VK_NULL_HANDLE;
-  VkDeviceSize staging_buffer_size_ = 0;
+  Slot slots_[kSlotCount];
+  // The slot that the next frame is uploaded to.
+  size_t next_slot_ = 0;
 };
 }  // namespace flutter
 
@@ -11,6 +11,9 @@
 #include <tbm_bufmgr.h>
 #include <tbm_surface.h>
 #include <tbm_surface_internal.h>
+
+#include <algorithm>
+
 #ifndef EGL_DMA_BUF_PLANE3_FD_EXT
 #define EGL_DMA_BUF_PLANE3_FD_EXT 0x3440
 #endif
@@ -38,11 +41,39 @@ ExternalTextureSurfaceEGL::ExternalTextureSurfaceEGL(
     void* user_data)
     : ExternalGLTexture(gl_extension),
       texture_callback_(texture_callback),
-      user_data_(user_data) {}
+      user_data_(user_data),
+      observer_(new SurfaceObserver()) {
+  egl_create_image_ = reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(
+      eglGetProcAddress("eglCreateImageKHR"));
+  egl_destroy_image_ = reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(
+      eglGetProcAddress("eglDestroyImageKHR"));
+  gl_egl_image_target_texture_2d_ =
+      reinterpret_cast<PFNGLEGLIMAGETARGETTEXTURE2DOESPROC>(
+          eglGetProcAddress("glEGLImageTargetTexture2DOES"));
+}
 
 ExternalTextureSurfaceEGL::~ExternalTextureSurfaceEGL() {
-  if (state_->gl_texture != 0) {
-    glDeleteTextures(1, static_cast<GLuint*>(&state_->gl_texture));
+  std::vector<CachedImage> images;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    UpdateDestroyedImages();
+    for (const CachedImage& image : images_) {
+      UnwatchSurface(image);
+    }
+    images.swap(images_);
+  }
+  for (const CachedImage& image : images) {
+    ReleaseImage(image);
+  }
+
+  bool should_delete = false;
+  {
+    std::lock_guard<std::mutex> lock(observer_->mutex);
+    observer_->is_valid = false;
+    should_delete = observer_->handler_count == 0;
+  }
+  if (should_delete) {
+    delete observer_;
   }
 }
 
@@ -79,17 +110,106 @@ bool ExternalTextureSurfaceEGL::PopulateGLTexture(
     return false;
   }
 
-  PFNEGLCREATEIMAGEKHRPROC n_eglCreateImageKHR =
-      reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(
-          eglGetProcAddress("eglCreateImageKHR"));
-  EGLImageKHR egl_src_image = nullptr;
+  ReleaseDestroyedImages();
+  CachedImage* image = GetOrCreateImage(tbm_surface, info);
+  if (!image) {
+    if (gpu_surface->release_callback) {
+      gpu_surface->release_callback(gpu_surface->release_context);
+    }
+    return false;
+  }
+  opengl_texture->target = GL_TEXTURE_EXTERNAL_OES;
+  opengl_texture->name = image->texture;
+  opengl_texture->format = GL_RGBA8_OES;
+  opengl_texture->destruction_callback = nullptr;
+  opengl_texture->user_data = nullptr;
+  opengl_texture->width = width;
+  opengl_texture->height = height;
+  if (gpu_surface->release_callback) {
+    gpu_surface->release_callback(gpu_surface->release_context);
+  }
+  return true;
+}
+
+ExternalTextureSurfaceEGL::CachedImage*
+ExternalTextureSurfaceEGL::GetOrCreateImage(tbm_surface_h tbm_surface,
+                                            const tbm_surface_info_s& info) {
+  std::vector<CachedImage> stale_images;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    UpdateDestroyedImages();
+    for (auto iter = images_.begin(); iter != images_.end(); ++iter) {
+      if (iter->surface != tbm_surface || iter->is_surface_destroyed) {
+        continue;
+      }
+      if (iter->width == info.width && iter->height == info.height &&
+          iter->format == info.format) {
+        // Move to the back as the most recently used.
+        std::rotate(iter, iter + 1, images_.end());
+        return &images_.back();
+      }
+      // The surface has been reallocated with a different layout.
+      UnwatchSurface(*iter);
+      stale_images.push_back(*iter);
+      images_.erase(iter);
+      break;
+    }
+    if (images_.size() >= kMaxCachedImages) {
+      UnwatchSurface(images_.front());
+      stale_images.push_back(images_.front());
+      images_.erase(images_.begin());
+    }
+  }
+  for (const CachedImage& image : stale_images) {
+    ReleaseImage(image);
+  }
+
+  CachedImage image;
+  image.surface = tbm_surface;
+  image.width = info.width;
+  image.height = info.height;
+  image.format = info.format;
+  image.display = eglGetCurrentDisplay();
+  image.image = CreateImage(tbm_surface, info);
+  if (image.image == EGL_NO_IMAGE_KHR) {
+    if (state_->gl_extension != ExternalTextureExtensionType::kNone) {
+      FT_LOG(Error) << "eglCreateImageKHR failed with an error "
+                    << eglGetError() << " for texture ID: " << texture_id_;
+    } else {
+      FT_LOG(Error) << "Either EGL_TIZEN_image_native_surface or "
+                       "EGL_EXT_image_dma_buf_import shoule be supported.";
+    }
+    return nullptr;
+  }
+
+  glGenTextures(1, &image.texture);
+  glBindTexture(GL_TEXTURE_EXTERNAL_OES, image.texture);
+  // set the texture wrapping parameters
+  glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S,
+                  GL_CLAMP_TO_BORDER_OES);
+  glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T,
+                  GL_CLAMP_TO_BORDER_OES);
+  // set texture filtering parameters
+  glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  gl_egl_image_target_texture_2d_(GL_TEXTURE_EXTERNAL_OES, image.image);
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  // The surface may be freed and its address reused by a new surface, so
+  // the image is dropped as soon as the surface is destroyed.
+  WatchSurface(tbm_surface);
+  images_.push_back(image);
+  return &images_.back();
+}
 
+EGLImageKHR ExternalTextureSurfaceEGL::CreateImage(
+    tbm_surface_h tbm_surface,
+    const tbm_surface_info_s& info) {
   if (state_->gl_extension == ExternalTextureExtensionType::kNativeSurface) {
     const EGLint attribs[] = {EGL_IMAGE_PRESERVED_KHR, EGL_TRUE, EGL_NONE,
                               EGL_NONE};
-    egl_src_image =
-        n_eglCreateImageKHR(eglGetCurrentDisplay(), EGL_NO_CONTEXT,
-                            EGL_NATIVE_SURFACE_TIZEN, tbm_surface, attribs);
+    return egl_create_image_(eglGetCurrentDisplay(), EGL_NO_CONTEXT,
+                             EGL_NATIVE_SURFACE_TIZEN, tbm_surface, attribs);
   } else if (state_->gl_extension == ExternalTextureExtensionType::kDmaBuffer) {
     EGLint attribs[50];
     int atti = 0;
@@ -126,61 +246,99 @@ bool ExternalTextureSurfaceEGL::PopulateGLTexture(
       attribs[atti++] = info.planes[i].stride;
     }
     attribs[atti++] = EGL_NONE;
-    egl_src_image =
-        n_eglCreateImageKHR(eglGetCurrentDisplay(), EGL_NO_CONTEXT,
-                            EGL_LINUX_DMA_BUF_EXT, nullptr, attribs);
+    return egl_create_image_(eglGetCurrentDisplay(), EGL_NO_CONTEXT,
+                             EGL_LINUX_DMA_BUF_EXT, nullptr, attribs);
   }
+  return EGL_NO_IMAGE_KHR;
+}
 
-  if (!egl_src_image) {
-    if (state_->gl_extension != ExternalTextureExtensionType::kNone) {
-      FT_LOG(Error) << "eglCreateImageKHR failed with an error "
-                    << eglGetError() << " for texture ID: " << texture_id_;
-    } else {
-      FT_LOG(Error) << "Either EGL_TIZEN_image_native_surface or "
-                       "EGL_EXT_image_dma_buf_import shoule be supported.";
-    }
-    if (gpu_surface->release_callback) {
-      gpu_surface->release_callback(gpu_surface->release_context);
+void ExternalTextureSurfaceEGL::ReleaseImage(const CachedImage& image) {
+  if (image.texture != 0) {
+    glDeleteTextures(1, &image.texture);
+  }
+  if (image.image != EGL_NO_IMAGE_KHR) {
+    egl_destroy_image_(image.display, image.image);
+  }
+}
+
+void ExternalTextureSurfaceEGL::ReleaseDestroyedImages() {
+  std::vector<CachedImage> destroyed_images;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    UpdateDestroyedImages();
+    auto iter = std::stable_partition(
+        images_.begin(), images_.end(),
+        [](const CachedImage& image) { return !image.is_surface_destroyed; });
+    destroyed_images.assign(iter, images_.end());
+    images_.erase(iter, images_.end());
+  }
+  for (const CachedImage& image : destroyed_images) {
+    ReleaseImage(image);
+  }
+}
+
+void ExternalTextureSurfaceEGL::UpdateDestroyedImages() {
+  std::vector<tbm_surface_h> destroyed_surfaces;
+  {
+    std::lock_guard<std::mutex> lock(observer_->mutex);
+    destroyed_surfaces.swap(observer_->destroyed_surfaces);
+  }
+  for (tbm_surface_h surface : destroyed_surfaces) {
+    for (CachedImage& image : images_) {
+      if (image.surface == surface) {
+        image.is_surface_destroyed = true;
+      }
     }
-    return false;
   }
-  if (state_->gl_texture == 0) {
-    glGenTextures(1, static_cast<GLuint*>(&state_->gl_texture));
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES,
-                  static_cast<GLuint>(state_->gl_texture));
-    // set the texture wrapping parameters
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S,
-                    GL_CLAMP_TO_BORDER_OES);
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T,
-                    GL_CLAMP_TO_BORDER_OES);
-    // set texture filtering parameters
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+void ExternalTextureSurfaceEGL::WatchSurface(tbm_surface_h surface) {
+  {
+    std::lock_guard<std::mutex> lock(observer_->mutex);
+    observer_->handler_count++;
+  }
+  tbm_surface_internal_add_destroy_handler(surface, OnSurfaceDestroyed,
+                                           observer_);
+}
+
+void ExternalTextureSurfaceEGL::UnwatchSurface(const CachedImage& image) {
+  if (image.is_surface_destroyed) {
+    // The handler has already run.
+    return;
+  }
+  // libtbm ignores surfaces that have been freed since the last update, and
+  // no other surface at the same address can be registered by this texture
+  // because handlers are only added with |cache_mutex_| held.
+  tbm_surface_internal_remove_destroy_handler(image.surface,
+                                              OnSurfaceDestroyed, observer_);
+
+  std::lock_guard<std::mutex> lock(observer_->mutex);
+  auto& destroyed_surfaces = observer_->destroyed_surfaces;
+  auto iter = std::find(destroyed_surfaces.begin(), destroyed_surfaces.end(),
+                        image.surface);
+  if (iter != destroyed_surfaces.end()) {
+    // The handler ran after the last update and has been accounted for.
+    destroyed_surfaces.erase(iter);
   } else {
-    glBindTexture(GL_TEXTURE_EXTERNAL_OES,
-                  static_cast<GLuint>(state_->gl_texture));
+    observer_->handler_count--;
   }
-  PFNGLEGLIMAGETARGETTEXTURE2DOESPROC glEGLImageTargetTexture2DOES =
-      reinterpret_cast<PFNGLEGLIMAGETARGETTEXTURE2DOESPROC>(
-          eglGetProcAddress("glEGLImageTargetTexture2DOES"));
-  glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, egl_src_image);
-  if (egl_src_image) {
-    PFNEGLDESTROYIMAGEKHRPROC n_eglDestroyImageKHR =
-        reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(
-            eglGetProcAddress("eglDestroyImageKHR"));
-    n_eglDestroyImageKHR(eglGetCurrentDisplay(), egl_src_image);
+}
+
+void ExternalTextureSurfaceEGL::OnSurfaceDestroyed(tbm_surface_h surface,
+                                                   void* user_data) {
+  auto* observer = static_cast<SurfaceObserver*>(user_data);
+  bool should_delete = false;
+  {
+    std::lock_guard<std::mutex> lock(observer->mutex);
+    if (observer->is_valid) {
+      observer->destroyed_surfaces.push_back(surface);
+    }
+    observer->handler_count--;
+    should_delete = !observer->is_valid && observer->handler_count == 0;
   }
-  opengl_texture->target = GL_TEXTURE_EXTERNAL_OES;
-  opengl_texture->name = state_->gl_texture;
-  opengl_texture->format = GL_RGBA8_OES;
-  opengl_texture->destruction_callback = nullptr;
-  opengl_texture->user_data = nullptr;
-  opengl_texture->width = width;
-  opengl_texture->height = height;
-  if (gpu_surface->release_callback) {
-    gpu_surface->release_callback(gpu_surface->release_context);
+  if (should_delete) {
+    delete observer;
   }
-  return true;
 }
 
 }  // namespace flutter
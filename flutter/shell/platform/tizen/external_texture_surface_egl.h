@@ -5,6 +5,15 @@
 #ifndef EMBEDDER_EXTERNAL_TEXTURE_SURFACE_EGL_H_
 #define EMBEDDER_EXTERNAL_TEXTURE_SURFACE_EGL_H_
 
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+#include <tbm_surface.h>
+
+#include <mutex>
+#include <vector>
+
 #include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
@@ -32,8 +41,84 @@ class ExternalTextureSurfaceEGL : public ExternalGLTexture {
                          FlutterOpenGLTexture* opengl_texture) override;
 
  private:
+  // An image imported from a tbm surface and the texture it is bound to.
+  struct CachedImage {
+    tbm_surface_h surface = nullptr;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    tbm_format format = 0;
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLImageKHR image = EGL_NO_IMAGE_KHR;
+    GLuint texture = 0;
+    // Whether |surface| has been destroyed. Guarded by |cache_mutex_|.
+    bool is_surface_destroyed = false;
+  };
+
+  // State shared with the destroy handlers registered on tbm surfaces.
+  //
+  // libtbm calls a handler on the thread that destroys the surface, which
+  // may race with the destruction of the texture. The handlers therefore
+  // only touch this object, which is deleted once the texture is gone and no
+  // handler is registered anymore.
+  struct SurfaceObserver {
+    std::mutex mutex;
+    // Surfaces destroyed since the texture last checked.
+    std::vector<tbm_surface_h> destroyed_surfaces;
+    // The number of handlers that have neither run nor been removed.
+    size_t handler_count = 0;
+    // Cleared when the texture is destroyed.
+    bool is_valid = true;
+  };
+
+  // The maximum number of images kept alive. Video decoders usually cycle
+  // through a small pool of surfaces.
+  static constexpr size_t kMaxCachedImages = 8;
+
+  // Returns the cached image of |tbm_surface|, importing it first unless it
+  // has been imported with the same size and format. Returns null on
+  // failure.
+  CachedImage* GetOrCreateImage(tbm_surface_h tbm_surface,
+                                const tbm_surface_info_s& info);
+
+  // Imports |tbm_surface| as an EGLImage.
+  EGLImageKHR CreateImage(tbm_surface_h tbm_surface,
+                          const tbm_surface_info_s& info);
+
+  // Releases the GL and EGL objects of |image|. Must be called with a
+  // context current and without holding |cache_mutex_|.
+  void ReleaseImage(const CachedImage& image);
+
+  // Releases the images whose surfaces have been destroyed.
+  void ReleaseDestroyedImages();
+
+  // Marks the images whose surfaces have been destroyed. Must be called with
+  // |cache_mutex_| held.
+  void UpdateDestroyedImages();
+
+  // Registers and unregisters the destroy handler of |surface|. Must be
+  // called with |cache_mutex_| held.
+  void WatchSurface(tbm_surface_h surface);
+  void UnwatchSurface(const CachedImage& image);
+
+  // Called by libtbm on the thread that destroys |surface|. |user_data| is
+  // the SurfaceObserver of the texture.
+  static void OnSurfaceDestroyed(tbm_surface_h surface, void* user_data);
+
   FlutterDesktopGpuSurfaceTextureCallback texture_callback_ = nullptr;
   void* user_data_ = nullptr;
+
+  PFNEGLCREATEIMAGEKHRPROC egl_create_image_ = nullptr;
+  PFNEGLDESTROYIMAGEKHRPROC egl_destroy_image_ = nullptr;
+  PFNGLEGLIMAGETARGETTEXTURE2DOESPROC gl_egl_image_target_texture_2d_ =
+      nullptr;
+
+  // Imported images, the most recently used last. Entries are only added or
+  // removed on the raster thread.
+  std::vector<CachedImage> images_;
+  std::mutex cache_mutex_;
+
+  // Owned jointly with the registered destroy handlers.
+  SurfaceObserver* observer_ = nullptr;
 };
 
 }  // namespace flutter
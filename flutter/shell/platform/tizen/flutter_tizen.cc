@@ -14,6 +14,7 @@
 #include "flutter/shell/platform/tizen/flutter_tizen_view.h"
 #include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/shell/platform/tizen/public/flutter_platform_view.h"
+#include "flutter/shell/platform/tizen/startup_trace.h"
 #include "flutter/shell/platform/tizen/tizen_window.h"
 #include "flutter/shell/platform/tizen/tizen_window_ecore_wl2.h"
 
@@ -54,7 +55,9 @@ FlutterDesktopViewRef HandleForView(flutter::FlutterTizenView* view) {
 
 FlutterDesktopEngineRef FlutterDesktopEngineCreate(
     const FlutterDesktopEngineProperties& engine_properties) {
+  uint64_t start_us = flutter::StartupTrace::NowMicros();
   flutter::FlutterProjectBundle project(engine_properties);
+  flutter::StartupTrace::AddPhase("FlutterProjectBundle", start_us);
   if (project.HasArgument("--verbose-logging")) {
     flutter::Logger::SetLoggingLevel(flutter::kLogLevelDebug);
   }
@@ -62,9 +65,13 @@ FlutterDesktopEngineRef FlutterDesktopEngineCreate(
   if (project.GetArgumentValue("--tizen-logging-port", &logging_port)) {
     flutter::Logger::SetLoggingPort(std::stoi(logging_port));
   }
+  start_us = flutter::StartupTrace::NowMicros();
   flutter::Logger::Start();
+  flutter::StartupTrace::AddPhase("Logger::Start", start_us);
 
+  start_us = flutter::StartupTrace::NowMicros();
   auto engine = std::make_unique<flutter::FlutterTizenEngine>(project);
+  flutter::StartupTrace::AddPhase("FlutterTizenEngine", start_us);
   return HandleForEngine(engine.release());
 }
 
@@ -72,6 +79,71 @@ bool FlutterDesktopEngineRun(const FlutterDesktopEngineRef engine) {
   return EngineFromHandle(engine)->RunEngine();
 }
 
+bool FlutterDesktopEngineInitialize(FlutterDesktopEngineRef engine,
+                                    FlutterDesktopRendererType renderer_type) {
+  return EngineFromHandle(engine)->InitializeEngine(renderer_type);
+}
+
+bool FlutterDesktopEngineSetOffscreenRendering(
+    FlutterDesktopEngineRef engine,
+    int32_t width,
+    int32_t height,
+    double pixel_ratio,
+    FlutterDesktopOffscreenFrameCallback callback,
+    void* user_data) {
+  return EngineFromHandle(engine)->EnableOffscreenRendering(
+      width, height, pixel_ratio, callback, user_data);
+}
+
+void FlutterDesktopEngineSetTaskRunnerStatsEnabled(
+    FlutterDesktopEngineRef engine,
+    bool enabled) {
+  EngineFromHandle(engine)->event_loop()->SetStatsEnabled(enabled);
+}
+
+bool FlutterDesktopEngineGetTaskRunnerStats(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopTaskRunnerStats* stats) {
+  if (!stats || stats->struct_size != sizeof(FlutterDesktopTaskRunnerStats)) {
+    FT_LOG(Error) << "Invalid task runner stats struct.";
+    return false;
+  }
+  return EngineFromHandle(engine)->event_loop()->GetStats(stats);
+}
+
+void FlutterDesktopEngineSetFrameStatsEnabled(FlutterDesktopEngineRef engine,
+                                              bool enabled) {
+  EngineFromHandle(engine)->SetFrameStatsEnabled(enabled);
+}
+
+bool FlutterDesktopEngineGetFrameStats(FlutterDesktopEngineRef engine,
+                                       FlutterDesktopFrameStats* stats) {
+  if (!stats || stats->struct_size != sizeof(FlutterDesktopFrameStats)) {
+    FT_LOG(Error) << "Invalid frame stats struct.";
+    return false;
+  }
+  return EngineFromHandle(engine)->frame_stats()->GetStats(stats);
+}
+
+size_t FlutterDesktopGetStartupPhases(FlutterDesktopStartupPhase* phases,
+                                      size_t count) {
+  std::vector<flutter::StartupTraceEvent> events =
+      flutter::StartupTrace::GetEvents();
+  for (size_t i = 0; i < count && i < events.size(); i++) {
+    phases[i].name = events[i].name;
+    phases[i].start_us = events[i].start_us;
+    phases[i].end_us = events[i].end_us;
+  }
+  return events.size();
+}
+
+bool FlutterDesktopWriteStartupTrace(const char* path) {
+  if (!path) {
+    return false;
+  }
+  return flutter::StartupTrace::WriteChromeTrace(path);
+}
+
 void FlutterDesktopEngineShutdown(FlutterDesktopEngineRef engine_ref) {
   flutter::Logger::Stop();
 
@@ -196,17 +268,25 @@ FlutterDesktopViewRef FlutterDesktopViewCreateFromNewWindow(
 
   std::unique_ptr<flutter::TizenWindow> window;
 
+  uint64_t start_us = flutter::StartupTrace::NowMicros();
   window = std::make_unique<flutter::TizenWindowEcoreWl2>(
       window_geometry, window_properties.transparent,
       window_properties.focusable, window_properties.top_level,
       window_properties.pointing_device_support,
       window_properties.floating_menu_support, window_properties.window_handle,
       window_properties.renderer_type == kEVulkan);
+  flutter::StartupTrace::AddPhase("TizenWindowEcoreWl2", start_us);
+
+  // The renderer is created together with the view.
+  EngineFromHandle(engine)->SetPresentationPolicy(
+      window_properties.presentation_policy);
 
+  start_us = flutter::StartupTrace::NowMicros();
   auto view = std::make_unique<flutter::FlutterTizenView>(
       flutter::kImplicitViewId, std::move(window),
       std::unique_ptr<flutter::FlutterTizenEngine>(EngineFromHandle(engine)),
       window_properties.renderer_type, window_properties.user_pixel_ratio);
+  flutter::StartupTrace::AddPhase("FlutterTizenView", start_us);
 
   if (!view->engine()->IsRunning()) {
     if (!view->engine()->RunEngine()) {
@@ -224,6 +304,13 @@ uint32_t FlutterDesktopViewGetResourceId(FlutterDesktopViewRef view_ref) {
   return view->tizen_view()->GetResourceId();
 }
 
+void FlutterDesktopViewSetPresentationPolicy(
+    FlutterDesktopViewRef view_ref,
+    FlutterDesktopPresentationPolicy policy) {
+  flutter::FlutterTizenView* view = ViewFromHandle(view_ref);
+  view->engine()->SetPresentationPolicy(policy);
+}
+
 void FlutterDesktopRegisterViewFactory(
     FlutterDesktopPluginRegistrarRef registrar,
     const char* view_type,
@@ -261,6 +348,30 @@ bool FlutterDesktopTextureRegistrarMarkExternalTextureFrameAvailable(
       ->MarkTextureFrameAvailable(texture_id);
 }
 
+bool FlutterDesktopTextureRegistrarAcquirePixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    FlutterDesktopWritablePixelBuffer* buffer) {
+  return TextureRegistrarFromHandle(texture_registrar)
+      ->AcquirePixelBuffer(texture_id, buffer);
+}
+
+bool FlutterDesktopTextureRegistrarSubmitPixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    const FlutterDesktopWritablePixelBuffer* buffer) {
+  return TextureRegistrarFromHandle(texture_registrar)
+      ->SubmitPixelBuffer(texture_id, buffer->buffer_id);
+}
+
+void FlutterDesktopTextureRegistrarCancelPixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    const FlutterDesktopWritablePixelBuffer* buffer) {
+  TextureRegistrarFromHandle(texture_registrar)
+      ->CancelPixelBuffer(texture_id, buffer->buffer_id);
+}
+
 FlutterDesktopMessengerRef FlutterDesktopMessengerAddRef(
     FlutterDesktopMessengerRef messenger) {
   return messenger;
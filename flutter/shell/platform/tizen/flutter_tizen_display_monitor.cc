@@ -3,23 +3,74 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-#include <Ecore.h>
+#include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
+
 #include <system_info.h>
 
-#include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
+#include <cmath>
+#include <vector>
+
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_view.h"
+#include "flutter/shell/platform/tizen/logger.h"
 #include "flutter/shell/platform/tizen/system_utils.h"
 
 namespace flutter {
 
+namespace {
+
+// The measured refresh rate fluctuates slightly from frame to frame, so
+// smaller differences are not reported as a display change.
+constexpr double kRefreshRateToleranceHz = 0.5;
+
+}  // namespace
+
 FlutterTizenDisplayMonitor::FlutterTizenDisplayMonitor(
     FlutterTizenEngine* engine)
-    : engine_(engine) {}
+    : engine_(engine) {
+  ecore_pipe_ = ecore_pipe_add(
+      [](void* data, void* buffer, unsigned int nbyte) -> void {
+        auto* self = static_cast<FlutterTizenDisplayMonitor*>(data);
+        self->UpdateDisplaysIfChanged();
+      },
+      this);
+}
 
-FlutterTizenDisplayMonitor::~FlutterTizenDisplayMonitor() {}
+FlutterTizenDisplayMonitor::~FlutterTizenDisplayMonitor() {
+  if (ecore_pipe_) {
+    ecore_pipe_del(ecore_pipe_);
+  }
+}
 
 void FlutterTizenDisplayMonitor::UpdateDisplays() {
+  last_display_ = GetDisplay();
+  std::vector<FlutterEngineDisplay> displays = {last_display_};
+  engine_->UpdateDisplay(displays);
+}
+
+void FlutterTizenDisplayMonitor::UpdateDisplaysIfChanged() {
+  FlutterEngineDisplay display = GetDisplay();
+  if (std::abs(display.refresh_rate - last_display_.refresh_rate) <
+          kRefreshRateToleranceHz &&
+      display.width == last_display_.width &&
+      display.height == last_display_.height &&
+      display.device_pixel_ratio == last_display_.device_pixel_ratio) {
+    return;
+  }
+  FT_LOG(Info) << "Display changed: " << display.width << "x"
+               << display.height << " @ " << display.refresh_rate << "Hz";
+  last_display_ = display;
+  std::vector<FlutterEngineDisplay> displays = {display};
+  engine_->UpdateDisplay(displays);
+}
+
+void FlutterTizenDisplayMonitor::ScheduleUpdate() {
+  if (ecore_pipe_) {
+    ecore_pipe_write(ecore_pipe_, nullptr, 0);
+  }
+}
+
+FlutterEngineDisplay FlutterTizenDisplayMonitor::GetDisplay() {
   // TODO: Currently Tizen only supports one display device.
   // So, if Tizen supports multiple displays in the future, please implement to
   // get information about multiple displays.
@@ -29,11 +80,18 @@ void FlutterTizenDisplayMonitor::UpdateDisplays() {
   display.display_id = 0;
   display.single_display = true;
 
-  double fps = ecore_animator_frametime_get();
-  if (fps <= 0.0) {
-    display.refresh_rate = 0.0;
+  // Prefer the period measured from the display's vblanks over the animator
+  // setting of Ecore, which does not follow display mode changes.
+  VsyncWaiter* vsync_waiter = engine_->vsync_waiter();
+  if (vsync_waiter && vsync_waiter->GetLastVsyncNanos() != 0) {
+    display.refresh_rate = 1e9 / vsync_waiter->GetVsyncPeriodNanos();
   } else {
-    display.refresh_rate = 1 / fps;
+    double fps = ecore_animator_frametime_get();
+    if (fps <= 0.0) {
+      display.refresh_rate = 0.0;
+    } else {
+      display.refresh_rate = 1 / fps;
+    }
   }
 
   int32_t width = 0, height = 0, dpi = 0;
@@ -54,9 +112,7 @@ void FlutterTizenDisplayMonitor::UpdateDisplays() {
   display.width = width;
   display.height = height;
   display.device_pixel_ratio = ComputePixelRatio(dpi);
-
-  std::vector<FlutterEngineDisplay> displays = {display};
-  engine_->UpdateDisplay(displays);
+  return display;
 }
 
 }  // namespace flutter
@@ -6,6 +6,10 @@
 #ifndef EMBEDDER_FLUTTER_TIZEN_DISPLAY_MONITOR_H_
 #define EMBEDDER_FLUTTER_TIZEN_DISPLAY_MONITOR_H_
 
+#include <Ecore.h>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+
 namespace flutter {
 
 class FlutterTizenEngine;
@@ -17,8 +21,26 @@ class FlutterTizenDisplayMonitor {
   // Updates the display information and notifies the engine
   void UpdateDisplays();
 
+  // Schedules the display information to be updated on the main thread, e.g.
+  // when the refresh period of the display changed. The engine is notified
+  // only if the information actually changed. May be called from any thread.
+  void ScheduleUpdate();
+
  private:
+  // Notifies the engine if the display information differs from the last
+  // information sent.
+  void UpdateDisplaysIfChanged();
+
+  // Returns the current information of the default display.
+  FlutterEngineDisplay GetDisplay();
+
   FlutterTizenEngine* engine_;
+
+  // The display information last sent to the engine.
+  FlutterEngineDisplay last_display_ = {};
+
+  // Used to wake up the main thread from ScheduleUpdate().
+  Ecore_Pipe* ecore_pipe_ = nullptr;
 };
 }  // namespace flutter
 
@@ -5,7 +5,11 @@
 
 #include "flutter_tizen_engine.h"
 
+#include <Ecore.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
@@ -14,7 +18,9 @@
 #include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_view.h"
 #include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/startup_trace.h"
 #include "flutter/shell/platform/tizen/system_utils.h"
+#include "flutter/shell/platform/tizen/timer_vsync_waiter.h"
 #include "flutter/shell/platform/tizen/tizen_input_method_context.h"
 #include "flutter/shell/platform/tizen/tizen_renderer_egl.h"
 
@@ -29,6 +35,9 @@ namespace {
 // Unique number associated with platform tasks.
 constexpr size_t kPlatformTaskRunnerIdentifier = 1;
 
+// How long the timer vsync source waits for a vblank to align to.
+constexpr int kVblankTimeoutMs = 100;
+
 // Converts a LanguageInfo struct to a FlutterLocale struct. |info| must outlive
 // the returned value, since the returned FlutterLocale has pointers into it.
 FlutterLocale CovertToFlutterLocale(const LanguageInfo& info) {
@@ -47,6 +56,22 @@ FlutterLocale CovertToFlutterLocale(const LanguageInfo& info) {
   return locale;
 }
 
+// Parses |value| as a decimal integer. Returns false if |value| is not a
+// number or does not fit in a long.
+bool ParseInteger(const std::string& value, long* result) {
+  if (value.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  long parsed = std::strtol(value.c_str(), &end, 10);
+  if (errno == ERANGE || *end != '\0') {
+    return false;
+  }
+  *result = parsed;
+  return true;
+}
+
 }  // namespace
 
 FlutterTizenEngine::FlutterTizenEngine(const FlutterProjectBundle& project)
@@ -58,13 +83,32 @@ FlutterTizenEngine::FlutterTizenEngine(const FlutterProjectBundle& project)
   // Run flutter task on Tizen main loop.
   // Tizen engine has four threads (GPU thread, UI thread, IO thread, platform
   // thread). UI threads need to send flutter task to platform thread.
+  TaskTimerMode timer_mode = project_->HasArgument("--tizen-single-task-timer")
+                                 ? TaskTimerMode::kSingleDeadlineTimer
+                                 : TaskTimerMode::kTimerPerTask;
   event_loop_ = std::make_unique<TizenPlatformEventLoop>(
       std::this_thread::get_id(),  // main thread
-      embedder_api_.GetCurrentTime, [this](const auto* task) {
+      embedder_api_.GetCurrentTime,
+      [this](const auto* task) {
         if (embedder_api_.RunTask(this->engine_, task) != kSuccess) {
           FT_LOG(Error) << "Could not post an engine task.";
         }
-      });
+      },
+      timer_mode);
+  std::string time_budget_value;
+  if (project_->GetArgumentValue("--tizen-task-time-budget",
+                                 &time_budget_value)) {
+    long time_budget = 0;
+    if (ParseInteger(time_budget_value, &time_budget) && time_budget > 0) {
+      event_loop_->SetTimeBudget(std::chrono::microseconds(time_budget));
+    } else {
+      FT_LOG(Error) << "Invalid --tizen-task-time-budget value: "
+                    << time_budget_value;
+    }
+  }
+  if (project_->HasArgument("--tizen-task-runner-stats")) {
+    event_loop_->SetStatsEnabled(true);
+  }
 
   messenger_ = std::make_unique<FlutterDesktopMessenger>();
   messenger_->engine = this;
@@ -75,37 +119,238 @@ FlutterTizenEngine::FlutterTizenEngine(const FlutterProjectBundle& project)
   plugin_registrar_->engine = this;
 
   display_monitor_ = std::make_unique<FlutterTizenDisplayMonitor>(this);
+
+  project_->GetArgumentValue("--tizen-startup-trace", &startup_trace_path_);
+
+  hardware_rotation_enabled_ =
+      project_->HasArgument("--tizen-hardware-rotation");
+
+  // Ecore must not be called from the thread that initializes the engine.
+  animator_frame_time_ = ecore_animator_frametime_get();
+
+  frame_stats_ = std::make_unique<FrameStats>();
+  if (project_->HasArgument("--tizen-frame-stats")) {
+    frame_stats_->SetEnabled(true);
+  }
+  next_frame_pipe_ = ecore_pipe_add(
+      [](void* data, void* buffer, unsigned int nbyte) -> void {
+        auto* self = static_cast<FlutterTizenEngine*>(data);
+        self->next_frame_callback_requested_ = false;
+        if (StartupTrace::Finish() && !self->startup_trace_path_.empty()) {
+          if (!StartupTrace::WriteChromeTrace(self->startup_trace_path_)) {
+            FT_LOG(Error) << "Could not write the startup trace to "
+                          << self->startup_trace_path_;
+          }
+        }
+        if (self->frame_stats_->IsEnabled()) {
+          self->RequestNextFrameCallback();
+        }
+      },
+      this);
 }
 
 FlutterTizenEngine::~FlutterTizenEngine() {
+  JoinInitialization();
   StopEngine();
+  if (next_frame_pipe_) {
+    ecore_pipe_del(next_frame_pipe_);
+  }
 }
 
 std::unique_ptr<TizenRenderer> FlutterTizenEngine::CreateRenderer(
     FlutterDesktopRendererType renderer_type) {
   switch (renderer_type) {
-    case FlutterDesktopRendererType::kEGL:
-      return std::make_unique<TizenRendererEgl>(
+    case FlutterDesktopRendererType::kEGL: {
+      auto renderer = std::make_unique<TizenRendererEgl>(
           view_->tizen_view(), project_->HasArgument("--enable-impeller"));
+      renderer->SetAsyncTextureUploadEnabled(
+          project_->HasArgument("--tizen-async-texture-upload"));
+      return renderer;
+    }
     case FlutterDesktopRendererType::kEVulkan:
 #ifdef FLUTTER_TIZEN_EXPERIMENTAL
-      return std::make_unique<TizenRendererVulkan>(view_->tizen_view());
+    {
+      uint32_t frames_in_flight = TizenRendererVulkan::kDefaultFramesInFlight;
+      std::string frames_in_flight_value;
+      if (project_->GetArgumentValue("--tizen-vulkan-frames-in-flight",
+                                     &frames_in_flight_value)) {
+        long value = 0;
+        if (ParseInteger(frames_in_flight_value, &value) && value >= 1 &&
+            value <= static_cast<long>(
+                         TizenRendererVulkan::kMaxFramesInFlight)) {
+          frames_in_flight = static_cast<uint32_t>(value);
+        } else {
+          FT_LOG(Error) << "Invalid --tizen-vulkan-frames-in-flight value: "
+                        << frames_in_flight_value << ". Expected 1 to "
+                        << TizenRendererVulkan::kMaxFramesInFlight << ".";
+        }
+      }
+      return std::make_unique<TizenRendererVulkan>(
+          view_->tizen_view(), frames_in_flight, presentation_policy_);
+    }
 #else
       return nullptr;
 #endif
   }
 }
 
-bool FlutterTizenEngine::RunEngine() {
+bool FlutterTizenEngine::InitializeEngine(
+    FlutterDesktopRendererType renderer_type) {
   if (engine_ != nullptr) {
+    FT_LOG(Error) << "The engine has already been initialized.";
+    return false;
+  }
+  // The Vulkan renderer config refers to the device of an existing renderer.
+  if (renderer_type != FlutterDesktopRendererType::kEGL) {
+    FT_LOG(Error) << "Only EGL engines can be initialized ahead of a view.";
+    return false;
+  }
+  if (initialize_thread_.joinable()) {
+    FT_LOG(Error) << "The engine is already being initialized.";
+    return false;
+  }
+  initialize_thread_ = std::thread([this]() {
+    LaunchEngine(TizenRendererGL::CreateRendererConfig(), true, true,
+                 &initialized_engine_);
+  });
+  return true;
+}
+
+void FlutterTizenEngine::JoinInitialization() {
+  if (!initialize_thread_.joinable()) {
+    return;
+  }
+  initialize_thread_.join();
+  engine_ = initialized_engine_;
+  initialized_engine_ = nullptr;
+}
+
+bool FlutterTizenEngine::EnableOffscreenRendering(
+    int32_t width,
+    int32_t height,
+    double pixel_ratio,
+    FlutterDesktopOffscreenFrameCallback callback,
+    void* user_data) {
+  if (engine_ != nullptr || initialize_thread_.joinable()) {
+    FT_LOG(Error) << "The engine has already been initialized.";
+    return false;
+  }
+  if (IsHeaded()) {
+    FT_LOG(Error) << "Offscreen rendering requires a headless engine.";
+    return false;
+  }
+  auto renderer = std::make_unique<TizenRendererEgl>(
+      width, height, project_->HasArgument("--enable-impeller"));
+  if (!renderer->IsValid()) {
+    FT_LOG(Error) << "Could not create an offscreen renderer.";
+    return false;
+  }
+  renderer->SetFrameStats(frame_stats_.get());
+  renderer->SetAsyncTextureUploadEnabled(
+      project_->HasArgument("--tizen-async-texture-upload"));
+  if (callback) {
+    renderer->SetOffscreenFrameCallback(
+        [callback, user_data](const uint8_t* pixels, int32_t width,
+                              int32_t height) {
+          FlutterDesktopOffscreenFrame frame = {};
+          frame.pixels = pixels;
+          frame.width = width;
+          frame.height = height;
+          frame.row_bytes = static_cast<size_t>(width) * 4;
+          callback(&frame, user_data);
+        });
+  }
+  renderer_ = std::move(renderer);
+  offscreen_width_ = width;
+  offscreen_height_ = height;
+  offscreen_pixel_ratio_ = pixel_ratio;
+  return true;
+}
+
+bool FlutterTizenEngine::RunEngine() {
+  if (IsRunning()) {
     FT_LOG(Error) << "The engine has already started.";
     return false;
   }
-  if (IsHeaded() && !renderer_->IsValid()) {
-    FT_LOG(Error) << "The display was not valid.";
+  JoinInitialization();
+  bool is_headed_egl =
+      IsHeaded() && dynamic_cast<TizenRendererEgl*>(renderer_.get());
+  if (engine_ != nullptr) {
+    // The engine was initialized by InitializeEngine().
+    if (!is_headed_egl) {
+      FT_LOG(Error) << "The engine was initialized for an EGL view.";
+      return false;
+    }
+    if (!renderer_->IsValid()) {
+      FT_LOG(Error) << "The display was not valid.";
+      return false;
+    }
+    uint64_t start_us = StartupTrace::NowMicros();
+    FlutterEngineResult result = embedder_api_.RunInitialized(engine_);
+    StartupTrace::AddPhase("FlutterEngineRunInitialized", start_us);
+    if (result != kSuccess) {
+      FT_LOG(Error) << "Failed to run the initialized Flutter engine with "
+                    << "error: " << result;
+      return false;
+    }
+  } else if (!LaunchEngine(GetRendererConfig(), is_headed_egl, false,
+                           &engine_)) {
     return false;
   }
+  is_running_ = true;
 
+  uint64_t channels_start_us = StartupTrace::NowMicros();
+  internal_plugin_registrar_ =
+      std::make_unique<PluginRegistrar>(plugin_registrar_.get());
+  accessibility_channel_ = std::make_unique<AccessibilityChannel>(
+      internal_plugin_registrar_->messenger());
+  app_control_channel_ = std::make_unique<AppControlChannel>(
+      internal_plugin_registrar_->messenger());
+  lifecycle_channel_ = std::make_unique<LifecycleChannel>(
+      internal_plugin_registrar_->messenger());
+  settings_channel_ = std::make_unique<SettingsChannel>(
+      internal_plugin_registrar_->messenger());
+
+  if (IsHeaded()) {
+    texture_registrar_ = std::make_unique<FlutterTizenTextureRegistrar>(this);
+    keyboard_channel_ = std::make_unique<KeyboardChannel>(
+        internal_plugin_registrar_->messenger(),
+        [this](const FlutterKeyEvent& event, FlutterKeyEventCallback callback,
+               void* user_data) { SendKeyEvent(event, callback, user_data); });
+    navigation_channel_ = std::make_unique<NavigationChannel>(
+        internal_plugin_registrar_->messenger());
+  }
+  if (project_->HasArgument("--tizen-frame-stats")) {
+    frame_stats_channel_ = std::make_unique<FrameStatsChannel>(
+        internal_plugin_registrar_->messenger(), frame_stats_.get());
+  }
+  accessibility_settings_ = std::make_unique<AccessibilitySettings>(this);
+  StartupTrace::AddPhase("SetupChannels", channels_start_us);
+
+  if (!IsHeaded() && renderer_) {
+    // Offscreen engines have no view to report their size.
+    SendWindowMetrics(0, 0, offscreen_width_, offscreen_height_,
+                      offscreen_pixel_ratio_);
+  }
+
+  display_monitor_->UpdateDisplays();
+
+  {
+    StartupTraceScope scope("SetupLocales");
+    SetupLocales();
+  }
+
+  // Also reports the first frame to the startup trace.
+  RequestNextFrameCallback();
+
+  return true;
+}
+
+bool FlutterTizenEngine::LaunchEngine(
+    const FlutterRendererConfig& renderer_config,
+    bool is_headed_egl,
+    bool initialize_only,
+    FLUTTER_API_SYMBOL(FlutterEngine) * engine) {
   if (!project_->HasValidPaths()) {
     FT_LOG(Error) << "Missing or unresolvable paths to assets.";
     return false;
@@ -113,6 +358,7 @@ bool FlutterTizenEngine::RunEngine() {
   std::string assets_path_string = project_->assets_path().u8string();
   std::string icu_path_string = project_->icu_path().u8string();
   if (embedder_api_.RunsAOTCompiledDartCode()) {
+    StartupTraceScope scope("LoadAotData");
     aot_data_ = project_->LoadAotData(embedder_api_);
     if (!aot_data_) {
       FT_LOG(Error) << "Unable to start engine without AOT data.";
@@ -120,6 +366,14 @@ bool FlutterTizenEngine::RunEngine() {
     }
   }
 
+  // The renderer may have been setting up its surface in the meantime. The
+  // view may be set concurrently while initializing, in which case RunEngine
+  // checks the renderer instead.
+  if (!initialize_only && IsHeaded() && !renderer_->IsValid()) {
+    FT_LOG(Error) << "The display was not valid.";
+    return false;
+  }
+
   // FlutterProjectArgs is expecting a full argv, so when processing it for
   // flags the first item is treated as the executable and ignored. Add a dummy
   // value so that all provided arguments are used.
@@ -196,8 +450,56 @@ bool FlutterTizenEngine::RunEngine() {
     engine->OnUpdateSemantics(update);
   };
 
-  if (IsHeaded() && dynamic_cast<TizenRendererEgl*>(renderer_.get())) {
-    vsync_waiter_ = std::make_unique<TizenVsyncWaiter>(this);
+  VsyncSource vsync_source = VsyncSource::kNone;
+  if (is_headed_egl) {
+    vsync_source = VsyncSource::kTdm;
+  }
+  // --tizen-vsync-source selects the vsync source:
+  // - tdm: vblank events of the display (the default for headed EGL engines)
+  // - timer: a timer ticking at the animator frame time. The ticks are
+  //   aligned to one vblank sampled from TDM when the timer starts. Without
+  //   TDM, e.g. on devices without a display, there is no vblank reference
+  //   and the ticks are aligned to multiples of the period on the monotonic
+  //   clock instead.
+  // - none: the engine uses its internal timing
+  std::string vsync_source_name;
+  if (project_->GetArgumentValue("--tizen-vsync-source", &vsync_source_name)) {
+    if (vsync_source_name == "tdm") {
+      vsync_source = VsyncSource::kTdm;
+    } else if (vsync_source_name == "timer") {
+      vsync_source = VsyncSource::kTimer;
+    } else if (vsync_source_name == "none") {
+      vsync_source = VsyncSource::kNone;
+    } else {
+      FT_LOG(Error) << "Unknown vsync source: " << vsync_source_name;
+    }
+  }
+
+  VsyncCallback on_vsync = [this](intptr_t baton,
+                                  uint64_t frame_start_time_nanos,
+                                  uint64_t frame_target_time_nanos) {
+    OnVsync(baton, frame_start_time_nanos, frame_target_time_nanos);
+  };
+  if (vsync_source == VsyncSource::kTdm) {
+    vsync_waiter_ = std::make_unique<TizenVsyncWaiter>(on_vsync);
+  } else if (vsync_source == VsyncSource::kTimer) {
+    uint64_t period_nanos = VsyncPeriodEstimator::kDefaultPeriodNanos;
+    if (animator_frame_time_ > 0.0) {
+      period_nanos = static_cast<uint64_t>(animator_frame_time_ * 1e9);
+    }
+    // Sampled once on the timer thread, so engine startup does not wait for
+    // the display.
+    TimerVsyncWaiter::VblankSource vblank_source = [](uint64_t* vblank_nanos) {
+      TdmClient tdm_client;
+      return tdm_client.WaitForVblankTimestamp(kVblankTimeoutMs, vblank_nanos);
+    };
+    vsync_waiter_ = std::make_unique<TimerVsyncWaiter>(on_vsync, period_nanos,
+                                                       vblank_source);
+  }
+  if (vsync_waiter_) {
+    vsync_waiter_->SetPeriodChangedCallback([this](uint64_t period_nanos) {
+      display_monitor_->ScheduleUpdate();
+    });
     args.vsync_callback = [](void* user_data, intptr_t baton) -> void {
       auto* engine = static_cast<FlutterTizenEngine*>(user_data);
       std::lock_guard<std::mutex> lock(engine->vsync_mutex_);
@@ -207,43 +509,25 @@ bool FlutterTizenEngine::RunEngine() {
     };
   }
 
-  FlutterRendererConfig renderer_config = GetRendererConfig();
-
-  FlutterEngineResult result = embedder_api_.Run(
-      FLUTTER_ENGINE_VERSION, &renderer_config, &args, this, &engine_);
-  if (result != kSuccess || engine_ == nullptr) {
+  FlutterEngineResult result;
+  uint64_t start_us = StartupTrace::NowMicros();
+  if (initialize_only) {
+    result = embedder_api_.Initialize(FLUTTER_ENGINE_VERSION, &renderer_config,
+                                      &args, this, engine);
+    StartupTrace::AddPhase("FlutterEngineInitialize", start_us);
+  } else {
+    result = embedder_api_.Run(FLUTTER_ENGINE_VERSION, &renderer_config, &args,
+                               this, engine);
+    StartupTrace::AddPhase("FlutterEngineRun", start_us);
+  }
+  if (result != kSuccess || *engine == nullptr) {
     FT_LOG(Error) << "Failed to start the Flutter engine with error: "
                   << result;
+    *engine = nullptr;
+    std::lock_guard<std::mutex> lock(vsync_mutex_);
+    vsync_waiter_.reset();
     return false;
   }
-
-  internal_plugin_registrar_ =
-      std::make_unique<PluginRegistrar>(plugin_registrar_.get());
-  accessibility_channel_ = std::make_unique<AccessibilityChannel>(
-      internal_plugin_registrar_->messenger());
-  app_control_channel_ = std::make_unique<AppControlChannel>(
-      internal_plugin_registrar_->messenger());
-  lifecycle_channel_ = std::make_unique<LifecycleChannel>(
-      internal_plugin_registrar_->messenger());
-  settings_channel_ = std::make_unique<SettingsChannel>(
-      internal_plugin_registrar_->messenger());
-
-  if (IsHeaded()) {
-    texture_registrar_ = std::make_unique<FlutterTizenTextureRegistrar>(this);
-    keyboard_channel_ = std::make_unique<KeyboardChannel>(
-        internal_plugin_registrar_->messenger(),
-        [this](const FlutterKeyEvent& event, FlutterKeyEventCallback callback,
-               void* user_data) { SendKeyEvent(event, callback, user_data); });
-    navigation_channel_ = std::make_unique<NavigationChannel>(
-        internal_plugin_registrar_->messenger());
-  }
-
-  accessibility_settings_ = std::make_unique<AccessibilitySettings>(this);
-
-  display_monitor_->UpdateDisplays();
-
-  SetupLocales();
-
   return true;
 }
 
@@ -258,6 +542,11 @@ void FlutterTizenEngine::UpdateDisplay(
 
 bool FlutterTizenEngine::StopEngine() {
   if (engine_) {
+    TaskTimerStats timer_stats = event_loop_->GetTimerStats();
+    FT_LOG(Debug) << "Platform task timers created: "
+                  << timer_stats.timers_created
+                  << ", wakeups: " << timer_stats.wakeups;
+
     for (const auto& [callback, registrar] :
          plugin_registrar_destruction_callbacks_) {
       callback(registrar);
@@ -273,6 +562,8 @@ bool FlutterTizenEngine::StopEngine() {
     FlutterEngineResult result = embedder_api_.Shutdown(engine_);
     view_ = nullptr;
     engine_ = nullptr;
+    is_running_ = false;
+    next_frame_callback_requested_ = false;
     return (result == kSuccess);
   }
   return false;
@@ -282,6 +573,47 @@ void FlutterTizenEngine::SetView(FlutterTizenView* view,
                                  FlutterDesktopRendererType renderer_type) {
   view_ = view;
   renderer_ = CreateRenderer(renderer_type);
+  if (renderer_) {
+    renderer_->SetFrameStats(frame_stats_.get());
+  }
+}
+
+void FlutterTizenEngine::SetPresentationPolicy(
+    FlutterDesktopPresentationPolicy policy) {
+  presentation_policy_ = policy;
+#ifdef FLUTTER_TIZEN_EXPERIMENTAL
+  if (auto* renderer = dynamic_cast<TizenRendererVulkan*>(renderer_.get())) {
+    renderer->SetPresentationPolicy(policy);
+  }
+#endif
+}
+
+void FlutterTizenEngine::SetFrameStatsEnabled(bool enabled) {
+  frame_stats_->SetEnabled(enabled);
+  if (enabled) {
+    RequestNextFrameCallback();
+  }
+}
+
+void FlutterTizenEngine::RequestNextFrameCallback() {
+  if (!IsRunning() || next_frame_callback_requested_) {
+    return;
+  }
+  // The callback is invoked on the raster thread and only once, so it hops
+  // back to the main thread to be requested again (the embedder API must be
+  // called on the platform thread). Frames drawn in between are not reported
+  // by the callback, so |frame_stats_| relies on it only for renderers that
+  // do not report presentation, which all current renderers do.
+  FlutterEngineResult result = embedder_api_.SetNextFrameCallback(
+      engine_,
+      [](void* user_data) {
+        auto* self = static_cast<FlutterTizenEngine*>(user_data);
+        StartupTrace::AddInstant("FirstFrame");
+        self->frame_stats_->OnFrameDrawn(FrameStats::Now());
+        ecore_pipe_write(self->next_frame_pipe_, nullptr, 0);
+      },
+      this);
+  next_frame_callback_requested_ = (result == kSuccess);
 }
 
 void FlutterTizenEngine::AddPluginRegistrarDestructionCallback(
@@ -354,11 +686,15 @@ void FlutterTizenEngine::SendWindowMetrics(int32_t x,
   event.height = static_cast<size_t>(height);
   event.pixel_ratio = pixel_ratio;
   embedder_api_.SendWindowMetricsEvent(engine_, &event);
+
+  // The display information depends on the view geometry.
+  display_monitor_->ScheduleUpdate();
 }
 
 void FlutterTizenEngine::OnVsync(intptr_t baton,
                                  uint64_t frame_start_time_nanos,
                                  uint64_t frame_target_time_nanos) {
+  frame_stats_->OnVsync(frame_start_time_nanos, frame_target_time_nanos);
   embedder_api_.OnVsync(engine_, baton, frame_start_time_nanos,
                         frame_target_time_nanos);
 }
@@ -444,7 +780,8 @@ FlutterDesktopMessage FlutterTizenEngine::ConvertToDesktopMessage(
 }
 
 FlutterRendererConfig FlutterTizenEngine::GetRendererConfig() {
-  if (IsHeaded()) {
+  // Headless engines have a renderer only if they render offscreen.
+  if (IsHeaded() || renderer_) {
     return renderer()->GetRendererConfig();
   } else {
     FlutterRendererConfig config = {};
@@ -8,6 +8,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <thread>
 
 #include "flutter/shell/platform/common/accessibility_bridge.h"
 #include "flutter/shell/platform/common/client_wrapper/include/flutter/plugin_registrar.h"
@@ -16,6 +18,7 @@
 #include "flutter/shell/platform/tizen/accessibility_settings.h"
 #include "flutter/shell/platform/tizen/channels/accessibility_channel.h"
 #include "flutter/shell/platform/tizen/channels/app_control_channel.h"
+#include "flutter/shell/platform/tizen/channels/frame_stats_channel.h"
 #include "flutter/shell/platform/tizen/channels/keyboard_channel.h"
 #include "flutter/shell/platform/tizen/channels/lifecycle_channel.h"
 #include "flutter/shell/platform/tizen/channels/navigation_channel.h"
@@ -24,10 +27,12 @@
 #include "flutter/shell/platform/tizen/flutter_project_bundle.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_display_monitor.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_texture_registrar.h"
+#include "flutter/shell/platform/tizen/frame_stats.h"
 #include "flutter/shell/platform/tizen/public/flutter_tizen.h"
 #include "flutter/shell/platform/tizen/tizen_event_loop.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
 #include "flutter/shell/platform/tizen/tizen_vsync_waiter.h"
+#include "flutter/shell/platform/tizen/vsync_waiter.h"
 
 // State associated with the plugin registrar.
 struct FlutterDesktopPluginRegistrar {
@@ -67,6 +72,29 @@ class FlutterTizenEngine {
   std::unique_ptr<TizenRenderer> CreateRenderer(
       FlutterDesktopRendererType renderer_type);
 
+  // Initializes the engine without running it, so that the work that does not
+  // depend on a view (such as loading AOT data and creating the engine
+  // threads) can be done before the view is created. The engine is then run
+  // by RunEngine() once a view with |renderer_type| has been set.
+  //
+  // The initialization runs on a worker thread while the caller goes on to
+  // create the view, and is joined by RunEngine(). If it fails, RunEngine()
+  // launches the engine as if it had not been initialized.
+  //
+  // Only the EGL renderer is supported. Returns false if the initialization
+  // couldn't be started.
+  bool InitializeEngine(FlutterDesktopRendererType renderer_type);
+
+  // Renders the frames of a headless engine offscreen and passes them to
+  // |callback| (if not null). Must be called before the engine is run.
+  //
+  // Returns false if offscreen rendering couldn't be set up.
+  bool EnableOffscreenRendering(int32_t width,
+                                int32_t height,
+                                double pixel_ratio,
+                                FlutterDesktopOffscreenFrameCallback callback,
+                                void* user_data);
+
   // Starts running the engine with the given entrypoint. If null, defaults to
   // main().
   //
@@ -74,7 +102,7 @@ class FlutterTizenEngine {
   bool RunEngine();
 
   // Returns true if the engine is currently running.
-  bool IsRunning() { return engine_ != nullptr; }
+  bool IsRunning() { return engine_ != nullptr && is_running_; }
 
   // Stops the engine.
   bool StopEngine();
@@ -83,6 +111,10 @@ class FlutterTizenEngine {
   void SetView(FlutterTizenView* view,
                FlutterDesktopRendererType renderer_type);
 
+  // Sets the presentation policy of the renderer. Applies to the renderer
+  // created by SetView() if called before it.
+  void SetPresentationPolicy(FlutterDesktopPresentationPolicy policy);
+
   // The view displaying this engine's content, if any. This will be null for
   // headless engines.
   FlutterTizenView* view() { return view_; }
@@ -103,6 +135,21 @@ class FlutterTizenEngine {
 
   TizenRenderer* renderer() { return renderer_.get(); }
 
+  TizenPlatformEventLoop* event_loop() { return event_loop_.get(); }
+
+  // Returns the vsync waiter, or null if the engine is not running or uses
+  // its own frame timing.
+  VsyncWaiter* vsync_waiter() { return vsync_waiter_.get(); }
+
+  FrameStats* frame_stats() { return frame_stats_.get(); }
+
+  // Whether views should let the display hardware rotate their contents
+  // instead of rendering them rotated. Set by --tizen-hardware-rotation.
+  bool hardware_rotation_enabled() const { return hardware_rotation_enabled_; }
+
+  // Enables or disables collection of frame statistics.
+  void SetFrameStatsEnabled(bool enabled);
+
   AppControlChannel* app_control_channel() {
     return app_control_channel_.get();
   }
@@ -204,6 +251,23 @@ class FlutterTizenEngine {
   FlutterDesktopMessage ConvertToDesktopMessage(
       const FlutterPlatformMessage& engine_message);
 
+  // Prepares the project arguments and calls either Initialize or Run of the
+  // embedder API with |renderer_config|, storing the engine in |engine|.
+  // |is_headed_egl| selects the default vsync source. May be called on a
+  // worker thread if |initialize_only| is true.
+  bool LaunchEngine(const FlutterRendererConfig& renderer_config,
+                    bool is_headed_egl,
+                    bool initialize_only,
+                    FLUTTER_API_SYMBOL(FlutterEngine) * engine);
+
+  // Waits for the initialization started by InitializeEngine(), if any, and
+  // adopts the initialized engine.
+  void JoinInitialization();
+
+  // Requests the engine to report the next drawn frame to the startup trace
+  // and |frame_stats_|, unless already requested.
+  void RequestNextFrameCallback();
+
   // Creates and returns a FlutterRendererConfig depending on the current
   // display mode (headed or headless).
   // The user_data received by the render callbacks refers to the
@@ -216,6 +280,17 @@ class FlutterTizenEngine {
   // The Flutter engine instance.
   FLUTTER_API_SYMBOL(FlutterEngine) engine_ = nullptr;
 
+  // Whether the engine has been run, as opposed to only initialized.
+  bool is_running_ = false;
+
+  // Runs LaunchEngine() for InitializeEngine() and stores the engine in
+  // |initialized_engine_|, which is null if the initialization failed.
+  std::thread initialize_thread_;
+  FLUTTER_API_SYMBOL(FlutterEngine) initialized_engine_ = nullptr;
+
+  // The animator frame time of Ecore, read on the main thread.
+  double animator_frame_time_ = 0.0;
+
   // The proc table of the embedder APIs.
   FlutterEngineProcTable embedder_api_ = {};
 
@@ -278,13 +353,39 @@ class FlutterTizenEngine {
   // An interface between the Flutter rasterizer and the platform.
   std::unique_ptr<TizenRenderer> renderer_;
 
+  // The size of offscreen frames, if enabled by EnableOffscreenRendering().
+  int32_t offscreen_width_ = 0;
+  int32_t offscreen_height_ = 0;
+  double offscreen_pixel_ratio_ = 1.0;
+
+  FlutterDesktopPresentationPolicy presentation_policy_ = kPresentationBalanced;
+
   std::mutex vsync_mutex_;
 
-  // The vsync waiter for the embedder.
-  std::unique_ptr<TizenVsyncWaiter> vsync_waiter_;
+  // The vsync waiter for the embedder, or null if the engine uses its own
+  // frame timing.
+  std::unique_ptr<VsyncWaiter> vsync_waiter_;
 
   // The display monitor.
   std::unique_ptr<FlutterTizenDisplayMonitor> display_monitor_;
+
+  // Frame timing statistics.
+  std::unique_ptr<FrameStats> frame_stats_;
+
+  // A channel to read |frame_stats_|, if enabled by --tizen-frame-stats.
+  std::unique_ptr<FrameStatsChannel> frame_stats_channel_;
+
+  // Whether rotation is done by the display hardware when possible.
+  bool hardware_rotation_enabled_ = false;
+
+  // Used to request the next frame callback again from the main thread.
+  Ecore_Pipe* next_frame_pipe_ = nullptr;
+
+  // Whether a next frame callback is pending.
+  bool next_frame_callback_requested_ = false;
+
+  // The file to write the startup trace to after the first frame, if any.
+  std::string startup_trace_path_;
 };
 
 }  // namespace flutter
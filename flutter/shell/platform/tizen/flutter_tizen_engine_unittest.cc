@@ -6,6 +6,8 @@
 
 #include <Ecore.h>
 
+#include <atomic>
+
 #include "flutter/shell/platform/embedder/test_utils/proc_table_replacement.h"
 #include "flutter/shell/platform/tizen/testing/engine_modifier.h"
 #include "gtest/gtest.h"
@@ -112,9 +114,21 @@ TEST_F(FlutterTizenEngineTest, RunDoesExpectedInitialization) {
         return kSuccess;
       }));
 
+  // It should request a callback for the first frame.
+  bool next_frame_callback_set = false;
+  modifier.embedder_api().SetNextFrameCallback = MOCK_ENGINE_PROC(
+      SetNextFrameCallback,
+      ([&next_frame_callback_set](auto engine, auto callback, auto user_data) {
+        next_frame_callback_set = true;
+        EXPECT_NE(callback, nullptr);
+
+        return kSuccess;
+      }));
+
   engine_->RunEngine();
 
   EXPECT_TRUE(run_called);
+  EXPECT_TRUE(next_frame_callback_set);
   EXPECT_TRUE(notify_display_update_called);
   EXPECT_TRUE(update_locales_called);
   EXPECT_TRUE(settings_message_sent);
@@ -124,6 +138,47 @@ TEST_F(FlutterTizenEngineTest, RunDoesExpectedInitialization) {
   modifier.embedder_api().Shutdown = [](auto engine) { return kSuccess; };
 }
 
+TEST_F(FlutterTizenEngineTest, InitializeDoesNotRunEngine) {
+  EngineModifier modifier(engine_);
+  // Written on the initialization thread.
+  std::atomic<bool> initialize_called = false;
+  modifier.embedder_api().Initialize = MOCK_ENGINE_PROC(
+      Initialize, ([&initialize_called](
+                       size_t version, const FlutterRendererConfig* config,
+                       const FlutterProjectArgs* args, void* user_data,
+                       FLUTTER_API_SYMBOL(FlutterEngine) * engine_out) {
+        initialize_called = true;
+        *engine_out = reinterpret_cast<FLUTTER_API_SYMBOL(FlutterEngine)>(1);
+
+        EXPECT_EQ(config->type, kOpenGL);
+        EXPECT_NE(config->open_gl.make_current, nullptr);
+        EXPECT_NE(args->custom_task_runners, nullptr);
+
+        return kSuccess;
+      }));
+  bool run_initialized_called = false;
+  modifier.embedder_api().RunInitialized = MOCK_ENGINE_PROC(
+      RunInitialized, ([&run_initialized_called](auto engine) {
+        run_initialized_called = true;
+        return kSuccess;
+      }));
+
+  EXPECT_FALSE(engine_->InitializeEngine(FlutterDesktopRendererType::kEVulkan));
+  EXPECT_FALSE(initialize_called);
+
+  EXPECT_TRUE(engine_->InitializeEngine(FlutterDesktopRendererType::kEGL));
+  modifier.JoinInitialization();
+  EXPECT_TRUE(initialize_called);
+  EXPECT_FALSE(engine_->IsRunning());
+
+  // The engine was initialized for a view, so it cannot run headless.
+  EXPECT_FALSE(engine_->RunEngine());
+  EXPECT_FALSE(run_initialized_called);
+  EXPECT_FALSE(engine_->IsRunning());
+
+  modifier.embedder_api().Shutdown = [](auto engine) { return kSuccess; };
+}
+
 TEST_F(FlutterTizenEngineTest, SendPlatformMessageWithoutResponse) {
   EngineModifier modifier(engine_);
 
@@ -231,6 +286,9 @@ TEST_F(FlutterTizenEngineTest, AddPluginRegistrarDestructionCallback) {
   modifier.embedder_api().SendPlatformMessage =
       MOCK_ENGINE_PROC(SendPlatformMessage,
                        ([](auto engine, auto message) { return kSuccess; }));
+  modifier.embedder_api().SetNextFrameCallback = MOCK_ENGINE_PROC(
+      SetNextFrameCallback,
+      ([](auto engine, auto callback, auto user_data) { return kSuccess; }));
 
   engine_->RunEngine();
 
@@ -8,6 +8,7 @@
 #include <mutex>
 
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/external_texture_pixel_egl.h"
 #include "flutter/shell/platform/tizen/external_texture_surface_egl.h"
 #include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
 #include "flutter/shell/platform/tizen/logger.h"
@@ -22,12 +23,15 @@ FlutterTizenTextureRegistrar::FlutterTizenTextureRegistrar(
 int64_t FlutterTizenTextureRegistrar::RegisterTexture(
     const FlutterDesktopTextureInfo* texture_info) {
   if (texture_info->type != kFlutterDesktopPixelBufferTexture &&
-      texture_info->type != kFlutterDesktopGpuSurfaceTexture) {
+      texture_info->type != kFlutterDesktopGpuSurfaceTexture &&
+      texture_info->type != kFlutterDesktopPixelBufferPoolTexture &&
+      texture_info->type != kFlutterDesktopExtendedPixelBufferTexture) {
     FT_LOG(Error) << "Attempted to register texture of unsupported type.";
     return -1;
   }
 
-  if (texture_info->type == kFlutterDesktopPixelBufferTexture) {
+  if (texture_info->type == kFlutterDesktopPixelBufferTexture ||
+      texture_info->type == kFlutterDesktopExtendedPixelBufferTexture) {
     if (!texture_info->pixel_buffer_config.callback) {
       FT_LOG(Error) << "Invalid pixel buffer texture callback.";
       return -1;
@@ -40,6 +44,26 @@ int64_t FlutterTizenTextureRegistrar::RegisterTexture(
       return -1;
     }
   }
+
+  // A pixel buffer pool texture is a GPU surface texture that shows the
+  // surfaces of its pool.
+  std::shared_ptr<PixelBufferPool> pixel_buffer_pool;
+  FlutterDesktopTextureInfo pool_texture_info = {};
+  if (texture_info->type == kFlutterDesktopPixelBufferPoolTexture) {
+    pixel_buffer_pool =
+        PixelBufferPool::Create(texture_info->pixel_buffer_pool_config);
+    if (!pixel_buffer_pool) {
+      FT_LOG(Error) << "Failed to create a pixel buffer pool.";
+      return -1;
+    }
+    pool_texture_info.type = kFlutterDesktopGpuSurfaceTexture;
+    pool_texture_info.gpu_surface_config.struct_size =
+        sizeof(FlutterDesktopGpuSurfaceTextureConfig);
+    pool_texture_info.gpu_surface_config.callback =
+        PixelBufferPool::GetFrontBufferCallback;
+    pool_texture_info.gpu_surface_config.user_data = pixel_buffer_pool.get();
+    texture_info = &pool_texture_info;
+  }
   std::unique_ptr<ExternalTexture> texture_gl = nullptr;
 
 #ifndef UNIT_TESTS
@@ -59,9 +83,22 @@ int64_t FlutterTizenTextureRegistrar::RegisterTexture(
   }
   int64_t texture_id = texture_gl->TextureId();
 
+  auto* pixel_texture =
+      dynamic_cast<ExternalTexturePixelEGL*>(texture_gl.get());
+  if (pixel_texture && pixel_texture->IsAsync()) {
+    // The engine is notified once the frame has been uploaded.
+    FlutterTizenEngine* engine = engine_;
+    pixel_texture->SetFrameUploadedCallback([engine, texture_id]() {
+      engine->MarkExternalTextureFrameAvailable(texture_id);
+    });
+  }
+
   {
     std::lock_guard<std::mutex> lock(map_mutex_);
     textures_[texture_id] = std::move(texture_gl);
+    if (pixel_buffer_pool) {
+      pixel_buffer_pools_[texture_id] = std::move(pixel_buffer_pool);
+    }
   }
 
   engine_->RegisterExternalTexture(texture_id);
@@ -72,12 +109,19 @@ bool FlutterTizenTextureRegistrar::UnregisterTexture(int64_t texture_id,
                                                      void (*callback)(void*),
                                                      void* user_data) {
   std::unique_ptr<ExternalTexture> texture;
+  std::shared_ptr<PixelBufferPool> pixel_buffer_pool;
   {
     std::lock_guard<std::mutex> lock(map_mutex_);
     auto iter = textures_.find(texture_id);
     if (iter == textures_.end()) {
       return false;
     }
+    auto pool_iter = pixel_buffer_pools_.find(texture_id);
+    if (pool_iter != pixel_buffer_pools_.end()) {
+      // The pool must outlive the texture that reads its surfaces.
+      pixel_buffer_pool = std::move(pool_iter->second);
+      pixel_buffer_pools_.erase(pool_iter);
+    }
     // Remove from the map first so no *new* PopulateGLTexture() lookup can
     // find this texture. A PopulateGLTexture() already in flight on the render
     // thread may still hold a raw pointer to it (it drops map_mutex_ before
@@ -105,7 +149,8 @@ bool FlutterTizenTextureRegistrar::UnregisterTexture(int64_t texture_id,
   // std::function, so the captured owner must be copyable.
   std::shared_ptr<ExternalTexture> tex(std::move(texture));
   engine->PostRenderThreadTask(
-      [engine, gl_renderer, texture_id, tex, callback, user_data]() mutable {
+      [engine, gl_renderer, texture_id, tex, pixel_buffer_pool, callback,
+       user_data]() mutable {
         // On the render thread, make the render context current so
         // glDeleteTextures in the texture's destructor targets the correct
         // context (the engine does not guarantee a current context when
@@ -122,6 +167,7 @@ bool FlutterTizenTextureRegistrar::UnregisterTexture(int64_t texture_id,
           gl_renderer->OnMakeCurrent();
         }
         tex.reset();
+        pixel_buffer_pool.reset();
         engine->UnregisterExternalTexture(texture_id);
         if (callback) {
           callback(user_data);
@@ -132,9 +178,60 @@ bool FlutterTizenTextureRegistrar::UnregisterTexture(int64_t texture_id,
 
 bool FlutterTizenTextureRegistrar::MarkTextureFrameAvailable(
     int64_t texture_id) {
+  {
+    std::lock_guard<std::mutex> lock(map_mutex_);
+    auto iter = textures_.find(texture_id);
+    if (iter != textures_.end()) {
+      auto* pixel_texture =
+          dynamic_cast<ExternalTexturePixelEGL*>(iter->second.get());
+      if (pixel_texture && pixel_texture->IsAsync() &&
+          pixel_texture->ScheduleUpload()) {
+        return true;
+      }
+    }
+  }
   return engine_->MarkExternalTextureFrameAvailable(texture_id);
 }
 
+std::shared_ptr<PixelBufferPool>
+FlutterTizenTextureRegistrar::GetPixelBufferPool(int64_t texture_id) {
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  auto iter = pixel_buffer_pools_.find(texture_id);
+  if (iter == pixel_buffer_pools_.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
+bool FlutterTizenTextureRegistrar::AcquirePixelBuffer(
+    int64_t texture_id,
+    FlutterDesktopWritablePixelBuffer* buffer) {
+  std::shared_ptr<PixelBufferPool> pool = GetPixelBufferPool(texture_id);
+  if (!pool) {
+    FT_LOG(Error) << "Texture " << texture_id
+                  << " is not a pixel buffer pool texture.";
+    return false;
+  }
+  return pool->Acquire(buffer);
+}
+
+bool FlutterTizenTextureRegistrar::SubmitPixelBuffer(int64_t texture_id,
+                                                     int64_t buffer_id) {
+  std::shared_ptr<PixelBufferPool> pool = GetPixelBufferPool(texture_id);
+  if (!pool || !pool->Submit(buffer_id)) {
+    return false;
+  }
+  return engine_->MarkExternalTextureFrameAvailable(texture_id);
+}
+
+void FlutterTizenTextureRegistrar::CancelPixelBuffer(int64_t texture_id,
+                                                     int64_t buffer_id) {
+  std::shared_ptr<PixelBufferPool> pool = GetPixelBufferPool(texture_id);
+  if (pool) {
+    pool->Cancel(buffer_id);
+  }
+}
+
 bool FlutterTizenTextureRegistrar::PopulateGLTexture(
     int64_t texture_id,
     size_t width,
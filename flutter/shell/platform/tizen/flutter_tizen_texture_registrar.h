@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/pixel_buffer_pool.h"
 #include "flutter/shell/platform/tizen/public/flutter_tizen.h"
 
 namespace flutter {
@@ -43,6 +44,23 @@ class FlutterTizenTextureRegistrar {
   // Returns true on success.
   bool MarkTextureFrameAvailable(int64_t texture_id);
 
+  // Maps a free buffer of the pixel buffer pool texture |texture_id| for
+  // writing.
+  //
+  // Returns true on success.
+  bool AcquirePixelBuffer(int64_t texture_id,
+                          FlutterDesktopWritablePixelBuffer* buffer);
+
+  // Shows the buffer |buffer_id| of the pixel buffer pool texture
+  // |texture_id| in the next frame.
+  //
+  // Returns true on success.
+  bool SubmitPixelBuffer(int64_t texture_id, int64_t buffer_id);
+
+  // Returns the buffer |buffer_id| to the pool of the pixel buffer pool
+  // texture |texture_id|.
+  void CancelPixelBuffer(int64_t texture_id, int64_t buffer_id);
+
   // Attempts to populate the given |texture| by copying the
   // contents of the texture identified by |texture_id|.
   //
@@ -62,7 +80,14 @@ class FlutterTizenTextureRegistrar {
 
   // All registered textures, keyed by their IDs.
   std::unordered_map<int64_t, std::unique_ptr<ExternalTexture>> textures_;
+  // The buffer pools of pixel buffer pool textures, keyed by the IDs of the
+  // textures that are drawn from them.
+  std::unordered_map<int64_t, std::shared_ptr<PixelBufferPool>>
+      pixel_buffer_pools_;
   std::mutex map_mutex_;
+
+  // Returns the buffer pool of |texture_id|, or null.
+  std::shared_ptr<PixelBufferPool> GetPixelBufferPool(int64_t texture_id);
 };
 
 }  // namespace flutter
@@ -115,6 +115,38 @@ TEST_F(FlutterTizenTextureRegistrarTest, RegisterUnknownTextureType) {
   EXPECT_EQ(texture_id, -1);
 }
 
+TEST_F(FlutterTizenTextureRegistrarTest, RegisterInvalidPixelBufferPool) {
+  EngineModifier modifier(engine_);
+
+  FlutterTizenTextureRegistrar registrar(engine_);
+
+  FlutterDesktopTextureInfo texture_info = {};
+  texture_info.type = kFlutterDesktopPixelBufferPoolTexture;
+  texture_info.pixel_buffer_pool_config.struct_size =
+      sizeof(FlutterDesktopPixelBufferPoolTextureConfig);
+  texture_info.pixel_buffer_pool_config.width = 0;
+  texture_info.pixel_buffer_pool_config.height = 480;
+  texture_info.pixel_buffer_pool_config.format =
+      kFlutterDesktopPixelFormatRGBA8888;
+
+  int64_t texture_id = registrar.RegisterTexture(&texture_info);
+  EXPECT_EQ(texture_id, -1);
+
+  texture_info.pixel_buffer_pool_config.width = 640;
+  texture_info.pixel_buffer_pool_config.format = kFlutterDesktopPixelFormatNone;
+
+  texture_id = registrar.RegisterTexture(&texture_info);
+  EXPECT_EQ(texture_id, -1);
+}
+
+TEST_F(FlutterTizenTextureRegistrarTest, AcquirePixelBufferOfInvalidTexture) {
+  FlutterTizenTextureRegistrar registrar(engine_);
+
+  FlutterDesktopWritablePixelBuffer buffer = {};
+  EXPECT_FALSE(registrar.AcquirePixelBuffer(1, &buffer));
+  EXPECT_FALSE(registrar.SubmitPixelBuffer(1, 0));
+}
+
 TEST_F(FlutterTizenTextureRegistrarTest, PopulateInvalidTexture) {
   FlutterTizenTextureRegistrar registrar(engine_);
 
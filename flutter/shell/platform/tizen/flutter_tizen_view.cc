@@ -117,7 +117,15 @@ void FlutterTizenView::OnRotate(int32_t degree) {
     rotation_degree_ = (degree % 360 + 360) % 360;
     const double w = width;
     const double h = height;
-    switch (rotation_degree_) {
+    auto* window = dynamic_cast<TizenWindow*>(tizen_view_.get());
+    bool hardware_rotation = false;
+    if (engine_->hardware_rotation_enabled() && window) {
+      // Falls back to rendering rotated contents (the transform is reset to
+      // 0) if the compositor cannot rotate them.
+      hardware_rotation = window->SetBufferTransform(rotation_degree_);
+    }
+    // The contents are rendered unrotated if the compositor rotates them.
+    switch (hardware_rotation ? 0 : rotation_degree_) {
       case 0:
         flutter_transformation_ = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
         break;
@@ -0,0 +1,146 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/frame_stats.h"
+
+#include <chrono>
+
+namespace flutter {
+
+namespace {
+
+// The engine pipelines at most this many frames. Older vsyncs that never
+// produced a frame are discarded.
+constexpr size_t kMaxPendingVsyncs = 3;
+
+}  // namespace
+
+FrameStats::FrameStats() = default;
+
+FrameStats::~FrameStats() = default;
+
+void FrameStats::SetEnabled(bool enabled) {
+  if (enabled) {
+    Reset();
+  }
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void FrameStats::Reset() {
+  {
+    std::lock_guard<std::mutex> lock(pending_vsyncs_mutex_);
+    pending_vsyncs_.clear();
+  }
+  frame_count_.store(0, std::memory_order_relaxed);
+  late_frame_count_.store(0, std::memory_order_relaxed);
+  dropped_frame_count_.store(0, std::memory_order_relaxed);
+  vsync_to_present_.Reset();
+  present_duration_.Reset();
+  frame_interval_.Reset();
+  gpu_time_.Reset();
+}
+
+void FrameStats::OnVsync(uint64_t frame_start_time_nanos,
+                         uint64_t frame_target_time_nanos) {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(pending_vsyncs_mutex_);
+  if (pending_vsyncs_.size() == kMaxPendingVsyncs) {
+    pending_vsyncs_.pop_front();
+  }
+  pending_vsyncs_.push_back({frame_start_time_nanos, frame_target_time_nanos});
+}
+
+void FrameStats::OnPresentBegin(uint64_t now_nanos) {
+  present_begin_nanos_ = now_nanos;
+}
+
+void FrameStats::OnPresentEnd(uint64_t now_nanos) {
+  if (!IsEnabled()) {
+    return;
+  }
+  present_duration_.Record(
+      std::chrono::nanoseconds(now_nanos - present_begin_nanos_));
+  presented_since_drawn_ = true;
+  RecordFrame(now_nanos);
+}
+
+void FrameStats::OnFrameDrawn(uint64_t now_nanos) {
+  if (!IsEnabled()) {
+    return;
+  }
+  // The frame has already been recorded when it was presented.
+  if (presented_since_drawn_) {
+    presented_since_drawn_ = false;
+    return;
+  }
+  RecordFrame(now_nanos);
+}
+
+void FrameStats::OnGpuTime(uint64_t elapsed_nanos) {
+  if (!IsEnabled()) {
+    return;
+  }
+  gpu_time_.Record(std::chrono::nanoseconds(elapsed_nanos));
+}
+
+void FrameStats::RecordFrame(uint64_t completion_nanos) {
+  frame_count_.fetch_add(1, std::memory_order_relaxed);
+
+  Vsync vsync;
+  {
+    std::lock_guard<std::mutex> lock(pending_vsyncs_mutex_);
+    if (pending_vsyncs_.empty()) {
+      // The engine used its own frame timing for this frame.
+      last_completion_nanos_ = completion_nanos;
+      return;
+    }
+    vsync = pending_vsyncs_.front();
+    pending_vsyncs_.pop_front();
+  }
+
+  vsync_to_present_.Record(
+      std::chrono::nanoseconds(completion_nanos - vsync.start_nanos));
+
+  uint64_t period = vsync.target_nanos - vsync.start_nanos;
+  if (completion_nanos > vsync.target_nanos && period > 0) {
+    late_frame_count_.fetch_add(1, std::memory_order_relaxed);
+    uint64_t overrun = completion_nanos - vsync.target_nanos;
+    dropped_frame_count_.fetch_add((overrun + period - 1) / period,
+                                   std::memory_order_relaxed);
+  }
+
+  // Only frames of a continuous animation contribute to the frame interval,
+  // i.e. idle time between animations is not counted as jank.
+  if (last_completion_nanos_ != 0 &&
+      last_completion_nanos_ + period >= vsync.start_nanos) {
+    frame_interval_.Record(
+        std::chrono::nanoseconds(completion_nanos - last_completion_nanos_));
+  }
+  last_completion_nanos_ = completion_nanos;
+}
+
+bool FrameStats::GetStats(FlutterDesktopFrameStats* stats) const {
+  if (!IsEnabled()) {
+    return false;
+  }
+  stats->frame_count = frame_count_.load(std::memory_order_relaxed);
+  stats->late_frame_count = late_frame_count_.load(std::memory_order_relaxed);
+  stats->dropped_frame_count =
+      dropped_frame_count_.load(std::memory_order_relaxed);
+  vsync_to_present_.CopyTo(&stats->vsync_to_present);
+  present_duration_.CopyTo(&stats->present_duration);
+  frame_interval_.CopyTo(&stats->frame_interval);
+  gpu_time_.CopyTo(&stats->gpu_time);
+  return true;
+}
+
+uint64_t FrameStats::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace flutter
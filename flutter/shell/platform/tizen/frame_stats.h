@@ -0,0 +1,97 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_FRAME_STATS_H_
+#define EMBEDDER_FRAME_STATS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "flutter/shell/platform/tizen/latency_histogram.h"
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
+
+namespace flutter {
+
+// Collects per-frame timing statistics.
+//
+// Vsync events are matched in order with the frames that complete after
+// them. A frame completes when it is presented, or, for renderers that do not
+// report presentation, when the engine reports that it has been drawn. The
+// latter misses frames drawn while the engine's next frame callback is
+// re-armed, so renderers should call OnPresentBegin and OnPresentEnd for
+// every frame.
+//
+// All timestamps are in nanoseconds on the monotonic clock (see Now()).
+class FrameStats {
+ public:
+  FrameStats();
+  ~FrameStats();
+
+  // Prevent copying.
+  FrameStats(const FrameStats&) = delete;
+  FrameStats& operator=(const FrameStats&) = delete;
+
+  // Enables or disables collection. Enabling clears all statistics.
+  void SetEnabled(bool enabled);
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Clears all statistics.
+  void Reset();
+
+  // Called on the vsync thread when a vsync is delivered to the engine.
+  void OnVsync(uint64_t frame_start_time_nanos,
+               uint64_t frame_target_time_nanos);
+
+  // Called on the raster thread right before and after presenting a frame.
+  void OnPresentBegin(uint64_t now_nanos);
+  void OnPresentEnd(uint64_t now_nanos);
+
+  // Called on the raster thread when the engine has drawn a frame.
+  void OnFrameDrawn(uint64_t now_nanos);
+
+  // Called on the raster thread with the GPU time of an earlier frame.
+  void OnGpuTime(uint64_t elapsed_nanos);
+
+  // Copies the statistics collected so far into |stats|. Returns false if
+  // collection is disabled.
+  bool GetStats(FlutterDesktopFrameStats* stats) const;
+
+  // Returns the current monotonic time.
+  static uint64_t Now();
+
+ private:
+  struct Vsync {
+    uint64_t start_nanos;
+    uint64_t target_nanos;
+  };
+
+  // Records a frame that completed at |completion_nanos|.
+  void RecordFrame(uint64_t completion_nanos);
+
+  std::atomic<bool> enabled_ = false;
+
+  // Vsyncs whose frame has not completed yet.
+  std::deque<Vsync> pending_vsyncs_;
+  std::mutex pending_vsyncs_mutex_;
+
+  // Only accessed on the raster thread.
+  uint64_t present_begin_nanos_ = 0;
+  uint64_t last_completion_nanos_ = 0;
+  bool presented_since_drawn_ = false;
+
+  std::atomic<uint64_t> frame_count_ = 0;
+  std::atomic<uint64_t> late_frame_count_ = 0;
+  std::atomic<uint64_t> dropped_frame_count_ = 0;
+  LatencyHistogram vsync_to_present_;
+  LatencyHistogram present_duration_;
+  LatencyHistogram frame_interval_;
+  LatencyHistogram gpu_time_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_FRAME_STATS_H_
@@ -0,0 +1,118 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/frame_stats.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr uint64_t kPeriod = 16000000;
+constexpr uint64_t kMillis = 1000000;
+
+FlutterDesktopFrameStats GetStats(const FrameStats& frame_stats) {
+  FlutterDesktopFrameStats stats = {};
+  stats.struct_size = sizeof(FlutterDesktopFrameStats);
+  EXPECT_TRUE(frame_stats.GetStats(&stats));
+  return stats;
+}
+
+}  // namespace
+
+TEST(FrameStatsTest, DisabledByDefault) {
+  FrameStats frame_stats;
+  frame_stats.OnVsync(0, kPeriod);
+  frame_stats.OnPresentBegin(10 * kMillis);
+  frame_stats.OnPresentEnd(11 * kMillis);
+
+  FlutterDesktopFrameStats stats = {};
+  EXPECT_FALSE(frame_stats.GetStats(&stats));
+}
+
+TEST(FrameStatsTest, RecordsPresentedFrames) {
+  FrameStats frame_stats;
+  frame_stats.SetEnabled(true);
+
+  frame_stats.OnVsync(0, kPeriod);
+  frame_stats.OnPresentBegin(10 * kMillis);
+  frame_stats.OnPresentEnd(12 * kMillis);
+  // Already recorded when presented.
+  frame_stats.OnFrameDrawn(12 * kMillis);
+
+  FlutterDesktopFrameStats stats = GetStats(frame_stats);
+  EXPECT_EQ(stats.frame_count, 1u);
+  EXPECT_EQ(stats.late_frame_count, 0u);
+  EXPECT_EQ(stats.dropped_frame_count, 0u);
+  EXPECT_EQ(stats.vsync_to_present.count, 1u);
+  EXPECT_EQ(stats.vsync_to_present.max_us, 12000u);
+  EXPECT_EQ(stats.present_duration.max_us, 2000u);
+  EXPECT_EQ(stats.frame_interval.count, 0u);
+}
+
+TEST(FrameStatsTest, CountsDroppedFrames) {
+  FrameStats frame_stats;
+  frame_stats.SetEnabled(true);
+
+  frame_stats.OnVsync(0, kPeriod);
+  frame_stats.OnPresentBegin(40 * kMillis);
+  frame_stats.OnPresentEnd(41 * kMillis);
+
+  FlutterDesktopFrameStats stats = GetStats(frame_stats);
+  EXPECT_EQ(stats.late_frame_count, 1u);
+  // 25ms past the target are two missed vsync intervals.
+  EXPECT_EQ(stats.dropped_frame_count, 2u);
+}
+
+TEST(FrameStatsTest, RecordsIntervalsOfContinuousFrames) {
+  FrameStats frame_stats;
+  frame_stats.SetEnabled(true);
+
+  for (uint64_t i = 0; i < 3; i++) {
+    frame_stats.OnVsync(i * kPeriod, (i + 1) * kPeriod);
+    frame_stats.OnFrameDrawn(i * kPeriod + 10 * kMillis);
+  }
+  // An idle second later.
+  uint64_t start = 1000 * kMillis;
+  frame_stats.OnVsync(start, start + kPeriod);
+  frame_stats.OnFrameDrawn(start + 10 * kMillis);
+
+  FlutterDesktopFrameStats stats = GetStats(frame_stats);
+  EXPECT_EQ(stats.frame_count, 4u);
+  EXPECT_EQ(stats.frame_interval.count, 2u);
+  EXPECT_EQ(stats.frame_interval.max_us, kPeriod / 1000);
+}
+
+TEST(FrameStatsTest, RecordsGpuTime) {
+  FrameStats frame_stats;
+  frame_stats.OnGpuTime(5 * kMillis);
+  frame_stats.SetEnabled(true);
+
+  frame_stats.OnGpuTime(3 * kMillis);
+  frame_stats.OnGpuTime(7 * kMillis);
+
+  FlutterDesktopFrameStats stats = GetStats(frame_stats);
+  EXPECT_EQ(stats.gpu_time.count, 2u);
+  EXPECT_EQ(stats.gpu_time.sum_us, 10000u);
+  EXPECT_EQ(stats.gpu_time.max_us, 7000u);
+  // GPU time is independent of frame completion.
+  EXPECT_EQ(stats.frame_count, 0u);
+}
+
+TEST(FrameStatsTest, EnablingClearsStats) {
+  FrameStats frame_stats;
+  frame_stats.SetEnabled(true);
+  frame_stats.OnVsync(0, kPeriod);
+  frame_stats.OnFrameDrawn(10 * kMillis);
+  EXPECT_EQ(GetStats(frame_stats).frame_count, 1u);
+
+  frame_stats.SetEnabled(false);
+  frame_stats.SetEnabled(true);
+  EXPECT_EQ(GetStats(frame_stats).frame_count, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,197 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/gl_proc_table.h"
+
+#include <EGL/egl.h>
+#include <GLES2/gl2.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace flutter {
+
+namespace {
+
+// Must be kept sorted by name in strcmp() order (uppercase before
+// lowercase). ALIAS entries are resolved with eglGetProcAddress() using the
+// name of the second argument.
+#define GL_PROCS(V, ALIAS)                                           \
+  V(eglGetCurrentDisplay)                                            \
+  V(eglQueryString)                                                  \
+  V(glActiveTexture)                                                 \
+  V(glAttachShader)                                                  \
+  V(glBindAttribLocation)                                            \
+  V(glBindBuffer)                                                    \
+  V(glBindFramebuffer)                                               \
+  V(glBindRenderbuffer)                                              \
+  V(glBindTexture)                                                   \
+  V(glBlendColor)                                                    \
+  V(glBlendEquation)                                                 \
+  V(glBlendFunc)                                                     \
+  V(glBufferData)                                                    \
+  V(glBufferSubData)                                                 \
+  V(glCheckFramebufferStatus)                                        \
+  V(glClear)                                                         \
+  V(glClearColor)                                                    \
+  V(glClearStencil)                                                  \
+  V(glColorMask)                                                     \
+  V(glCompileShader)                                                 \
+  V(glCompressedTexImage2D)                                          \
+  V(glCompressedTexSubImage2D)                                       \
+  V(glCopyTexSubImage2D)                                             \
+  V(glCreateProgram)                                                 \
+  V(glCreateShader)                                                  \
+  V(glCullFace)                                                      \
+  V(glDeleteBuffers)                                                 \
+  V(glDeleteFramebuffers)                                            \
+  V(glDeleteProgram)                                                 \
+  V(glDeleteRenderbuffers)                                           \
+  V(glDeleteShader)                                                  \
+  V(glDeleteTextures)                                                \
+  V(glDepthMask)                                                     \
+  V(glDisable)                                                       \
+  V(glDisableVertexAttribArray)                                      \
+  V(glDrawArrays)                                                    \
+  V(glDrawElements)                                                  \
+  V(glEnable)                                                        \
+  V(glEnableVertexAttribArray)                                       \
+  V(glFinish)                                                        \
+  V(glFlush)                                                         \
+  V(glFramebufferRenderbuffer)                                       \
+  V(glFramebufferTexture2D)                                          \
+  V(glFrontFace)                                                     \
+  V(glGenBuffers)                                                    \
+  V(glGenFramebuffers)                                               \
+  V(glGenRenderbuffers)                                              \
+  V(glGenTextures)                                                   \
+  V(glGenerateMipmap)                                                \
+  V(glGetBufferParameteriv)                                          \
+  V(glGetError)                                                      \
+  V(glGetFloatv)                                                     \
+  V(glGetFramebufferAttachmentParameteriv)                           \
+  V(glGetIntegerv)                                                   \
+  V(glGetProgramInfoLog)                                             \
+  V(glGetProgramiv)                                                  \
+  V(glGetRenderbufferParameteriv)                                    \
+  V(glGetShaderInfoLog)                                              \
+  V(glGetShaderPrecisionFormat)                                      \
+  V(glGetShaderiv)                                                   \
+  V(glGetString)                                                     \
+  V(glGetUniformLocation)                                            \
+  V(glIsTexture)                                                     \
+  V(glLineWidth)                                                     \
+  V(glLinkProgram)                                                   \
+  ALIAS(glMultiDrawArraysIndirectEXT, glMultiDrawArraysIndirect)     \
+  ALIAS(glMultiDrawElementsIndirectEXT, glMultiDrawElementsIndirect) \
+  V(glPixelStorei)                                                   \
+  V(glReadPixels)                                                    \
+  V(glRenderbufferStorage)                                           \
+  V(glScissor)                                                       \
+  V(glShaderSource)                                                  \
+  V(glStencilFunc)                                                   \
+  V(glStencilFuncSeparate)                                           \
+  V(glStencilMask)                                                   \
+  V(glStencilMaskSeparate)                                           \
+  V(glStencilOp)                                                     \
+  V(glStencilOpSeparate)                                             \
+  V(glTexImage2D)                                                    \
+  V(glTexParameterf)                                                 \
+  V(glTexParameterfv)                                                \
+  V(glTexParameteri)                                                 \
+  V(glTexParameteriv)                                                \
+  V(glTexSubImage2D)                                                 \
+  V(glUniform1f)                                                     \
+  V(glUniform1fv)                                                    \
+  V(glUniform1i)                                                     \
+  V(glUniform1iv)                                                    \
+  V(glUniform2f)                                                     \
+  V(glUniform2fv)                                                    \
+  V(glUniform2i)                                                     \
+  V(glUniform2iv)                                                    \
+  V(glUniform3f)                                                     \
+  V(glUniform3fv)                                                    \
+  V(glUniform3i)                                                     \
+  V(glUniform3iv)                                                    \
+  V(glUniform4f)                                                     \
+  V(glUniform4fv)                                                    \
+  V(glUniform4i)                                                     \
+  V(glUniform4iv)                                                    \
+  V(glUniformMatrix2fv)                                              \
+  V(glUniformMatrix3fv)                                              \
+  V(glUniformMatrix4fv)                                              \
+  V(glUseProgram)                                                    \
+  V(glVertexAttrib1f)                                                \
+  V(glVertexAttrib2fv)                                               \
+  V(glVertexAttrib3fv)                                               \
+  V(glVertexAttrib4fv)                                               \
+  V(glVertexAttribPointer)                                           \
+  V(glViewport)
+
+struct GlProc {
+  const char* name;
+  void* address;
+  const char* alias;
+};
+
+#define GL_PROC_NAME(Name) #Name,
+#define GL_PROC_ALIAS_NAME(Name, AliasName) #Name,
+constexpr const char* kNames[] = {GL_PROCS(GL_PROC_NAME, GL_PROC_ALIAS_NAME)};
+#undef GL_PROC_ALIAS_NAME
+#undef GL_PROC_NAME
+
+#define GL_PROC_ENTRY(Name) {#Name, reinterpret_cast<void*>(Name), nullptr},
+#define GL_PROC_ALIAS_ENTRY(Name, AliasName) {#Name, nullptr, #AliasName},
+const GlProc kProcs[] = {GL_PROCS(GL_PROC_ENTRY, GL_PROC_ALIAS_ENTRY)};
+#undef GL_PROC_ALIAS_ENTRY
+#undef GL_PROC_ENTRY
+
+#undef GL_PROCS
+
+constexpr int Compare(const char* a, const char* b) {
+  while (*a != '\0' && *a == *b) {
+    a++;
+    b++;
+  }
+  return static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+}
+
+constexpr bool IsSorted() {
+  for (size_t i = 1; i < std::size(kNames); i++) {
+    if (Compare(kNames[i - 1], kNames[i]) >= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(IsSorted(), "GL_PROCS must be sorted without duplicates.");
+
+}  // namespace
+
+void* GlProcTable::Lookup(const char* name) {
+  const GlProc* end = std::end(kProcs);
+  const GlProc* proc = std::lower_bound(
+      std::begin(kProcs), end, name, [](const GlProc& proc, const char* name) {
+        return strcmp(proc.name, name) < 0;
+      });
+  if (proc == end || strcmp(proc->name, name) != 0) {
+    return nullptr;
+  }
+  if (proc->alias) {
+    return reinterpret_cast<void*>(eglGetProcAddress(proc->alias));
+  }
+  return proc->address;
+}
+
+size_t GlProcTable::size() {
+  return std::size(kProcs);
+}
+
+const char* GlProcTable::NameAt(size_t index) {
+  return kProcs[index].name;
+}
+
+}  // namespace flutter
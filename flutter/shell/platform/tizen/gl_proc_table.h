@@ -0,0 +1,31 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_GL_PROC_TABLE_H_
+#define EMBEDDER_GL_PROC_TABLE_H_
+
+#include <cstddef>
+
+namespace flutter {
+
+// The GL and EGL functions that the embedder links against directly, for
+// drivers whose eglGetProcAddress() does not return core functions.
+class GlProcTable {
+ public:
+  // Returns the address of |name|, or null if it is not in the table.
+  //
+  // The table is sorted at compile time, so this is a binary search of about
+  // seven string comparisons.
+  static void* Lookup(const char* name);
+
+  // The number of functions in the table.
+  static size_t size();
+
+  // Returns the name of the |index|th function in sorted order.
+  static const char* NameAt(size_t index);
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_GL_PROC_TABLE_H_
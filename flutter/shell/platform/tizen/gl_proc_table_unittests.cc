@@ -0,0 +1,52 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/gl_proc_table.h"
+
+#include <EGL/egl.h>
+#include <GLES2/gl2.h>
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(GlProcTableTest, LookupKnownFunctions) {
+  EXPECT_EQ(GlProcTable::Lookup("eglGetCurrentDisplay"),
+            reinterpret_cast<void*>(eglGetCurrentDisplay));
+  EXPECT_EQ(GlProcTable::Lookup("glClear"), reinterpret_cast<void*>(glClear));
+  EXPECT_EQ(GlProcTable::Lookup("glClearColor"),
+            reinterpret_cast<void*>(glClearColor));
+  EXPECT_EQ(GlProcTable::Lookup("glViewport"),
+            reinterpret_cast<void*>(glViewport));
+}
+
+TEST(GlProcTableTest, LookupUnknownFunctions) {
+  EXPECT_EQ(GlProcTable::Lookup(""), nullptr);
+  EXPECT_EQ(GlProcTable::Lookup("glClea"), nullptr);
+  EXPECT_EQ(GlProcTable::Lookup("glClearColors"), nullptr);
+  EXPECT_EQ(GlProcTable::Lookup("glclear"), nullptr);
+  EXPECT_EQ(GlProcTable::Lookup("zzz"), nullptr);
+}
+
+TEST(GlProcTableTest, LookupEveryFunction) {
+  ASSERT_GT(GlProcTable::size(), 0u);
+  for (size_t i = 0; i < GlProcTable::size(); i++) {
+    const char* name = GlProcTable::NameAt(i);
+    if (i > 0) {
+      EXPECT_LT(strcmp(GlProcTable::NameAt(i - 1), name), 0);
+    }
+    // Extension aliases depend on the driver.
+    size_t length = strlen(name);
+    if (length > 3 && strcmp(name + length - 3, "EXT") == 0) {
+      continue;
+    }
+    EXPECT_NE(GlProcTable::Lookup(name), nullptr) << name;
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
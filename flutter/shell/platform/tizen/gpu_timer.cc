@@ -0,0 +1,106 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/gpu_timer.h"
+
+#include <EGL/egl.h>
+
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+std::unique_ptr<GpuTimer> GpuTimer::Create(ResultCallback callback) {
+  const char* extensions =
+      reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+  if (!extensions || !strstr(extensions, "GL_EXT_disjoint_timer_query")) {
+    FT_LOG(Info) << "GL_EXT_disjoint_timer_query is not supported. GPU time "
+                    "is not measured.";
+    return nullptr;
+  }
+
+  std::unique_ptr<GpuTimer> timer(new GpuTimer(std::move(callback)));
+  timer->gen_queries_ = reinterpret_cast<PFNGLGENQUERIESEXTPROC>(
+      eglGetProcAddress("glGenQueriesEXT"));
+  timer->begin_query_ = reinterpret_cast<PFNGLBEGINQUERYEXTPROC>(
+      eglGetProcAddress("glBeginQueryEXT"));
+  timer->end_query_ = reinterpret_cast<PFNGLENDQUERYEXTPROC>(
+      eglGetProcAddress("glEndQueryEXT"));
+  timer->get_query_objectuiv_ =
+      reinterpret_cast<PFNGLGETQUERYOBJECTUIVEXTPROC>(
+          eglGetProcAddress("glGetQueryObjectuivEXT"));
+  timer->get_query_objectui64v_ =
+      reinterpret_cast<PFNGLGETQUERYOBJECTUI64VEXTPROC>(
+          eglGetProcAddress("glGetQueryObjectui64vEXT"));
+  if (!timer->gen_queries_ || !timer->begin_query_ || !timer->end_query_ ||
+      !timer->get_query_objectuiv_ || !timer->get_query_objectui64v_) {
+    FT_LOG(Error) << "Could not resolve the timer query functions.";
+    return nullptr;
+  }
+  timer->gen_queries_(kQueryCount, timer->queries_.data());
+  return timer;
+}
+
+GpuTimer::GpuTimer(ResultCallback callback) : callback_(std::move(callback)) {}
+
+void GpuTimer::BeginFrame() {
+  if (is_active_) {
+    return;
+  }
+  CollectResults();
+  if (pending_count_ == kQueryCount) {
+    // All queries are in flight. Skip this frame rather than wait.
+    return;
+  }
+  begin_query_(GL_TIME_ELAPSED_EXT, queries_[next_query_]);
+  is_active_ = true;
+}
+
+void GpuTimer::EndFrame() {
+  if (!is_active_) {
+    return;
+  }
+  end_query_(GL_TIME_ELAPSED_EXT);
+  is_active_ = false;
+  next_query_ = (next_query_ + 1) % kQueryCount;
+  pending_count_++;
+}
+
+void GpuTimer::CollectResults() {
+  std::array<GLuint64, kQueryCount> results;
+  size_t result_count = 0;
+  while (pending_count_ > 0) {
+    size_t oldest = (next_query_ + kQueryCount - pending_count_) % kQueryCount;
+    GLuint available = 0;
+    get_query_objectuiv_(queries_[oldest], GL_QUERY_RESULT_AVAILABLE_EXT,
+                         &available);
+    if (!available) {
+      break;
+    }
+    GLuint64 elapsed = 0;
+    get_query_objectui64v_(queries_[oldest], GL_QUERY_RESULT_EXT, &elapsed);
+    pending_count_--;
+    if (discard_count_ > 0) {
+      discard_count_--;
+    } else {
+      results[result_count++] = elapsed;
+    }
+  }
+
+  // The flag is checked after reading the results, as recommended by the
+  // extension. Reading it also clears it, so the queries still in flight are
+  // discarded as well.
+  GLint disjoint = 0;
+  glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+  if (disjoint) {
+    discard_count_ = pending_count_;
+    return;
+  }
+  for (size_t i = 0; i < result_count; i++) {
+    callback_(results[i]);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,76 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_GPU_TIMER_H_
+#define EMBEDDER_GPU_TIMER_H_
+
+#include <GLES2/gl2.h>
+#include <GLES2/gl2ext.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace flutter {
+
+// Measures the GPU time of frames with GL_EXT_disjoint_timer_query.
+//
+// Each frame is bracketed by a timer query. Results are read back a few
+// frames later, once they are available, so the GPU is never waited for. If
+// the pipeline runs too far ahead for the queries in flight, frames are not
+// timed. Results that span a disjoint event (e.g. a GPU frequency change) are
+// discarded.
+//
+// All methods must be called on the same thread with the same context
+// current. The queries are released together with the context.
+class GpuTimer {
+ public:
+  // Called with the GPU time of a frame in nanoseconds.
+  using ResultCallback = std::function<void(uint64_t elapsed_nanos)>;
+
+  static constexpr size_t kQueryCount = 4;
+
+  // Returns null if the current context does not support timer queries.
+  static std::unique_ptr<GpuTimer> Create(ResultCallback callback);
+
+  // Prevent copying.
+  GpuTimer(const GpuTimer&) = delete;
+  GpuTimer& operator=(const GpuTimer&) = delete;
+
+  // Starts timing a frame, unless one is already being timed. Results of
+  // earlier frames that have become available are delivered first.
+  void BeginFrame();
+
+  // Stops timing the current frame, if any.
+  void EndFrame();
+
+ private:
+  explicit GpuTimer(ResultCallback callback);
+
+  // Delivers the results that are available without waiting.
+  void CollectResults();
+
+  ResultCallback callback_;
+
+  PFNGLGENQUERIESEXTPROC gen_queries_ = nullptr;
+  PFNGLBEGINQUERYEXTPROC begin_query_ = nullptr;
+  PFNGLENDQUERYEXTPROC end_query_ = nullptr;
+  PFNGLGETQUERYOBJECTUIVEXTPROC get_query_objectuiv_ = nullptr;
+  PFNGLGETQUERYOBJECTUI64VEXTPROC get_query_objectui64v_ = nullptr;
+
+  // A ring of queries. The |pending_count_| queries before |next_query_|
+  // have ended but have not been read yet.
+  std::array<GLuint, kQueryCount> queries_ = {};
+  size_t next_query_ = 0;
+  size_t pending_count_ = 0;
+  // The number of the oldest pending queries whose results are discarded
+  // because a disjoint event occurred while they were in flight.
+  size_t discard_count_ = 0;
+  bool is_active_ = false;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_GPU_TIMER_H_
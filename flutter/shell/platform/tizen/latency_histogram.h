@@ -0,0 +1,92 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_LATENCY_HISTOGRAM_H_
+#define EMBEDDER_LATENCY_HISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
+
+namespace flutter {
+
+// A histogram of durations with power-of-two microsecond buckets.
+//
+// Samples may be recorded and read concurrently from any thread. Readers may
+// observe a sample that has been counted in its bucket but not yet in the
+// totals, which is acceptable for telemetry purposes.
+class LatencyHistogram {
+ public:
+  static constexpr size_t kBucketCount = FLUTTER_DESKTOP_HISTOGRAM_BUCKET_COUNT;
+
+  LatencyHistogram() { Reset(); }
+
+  // Prevent copying.
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  // Adds a sample of |duration|. Negative durations are counted as zero.
+  void Record(std::chrono::nanoseconds duration) {
+    uint64_t micros = 0;
+    if (duration.count() > 0) {
+      micros = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::microseconds>(duration)
+              .count());
+    }
+    buckets_[BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_us_.fetch_add(micros, std::memory_order_relaxed);
+
+    uint64_t max = max_us_.load(std::memory_order_relaxed);
+    while (micros > max && !max_us_.compare_exchange_weak(
+                               max, micros, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Clears all samples.
+  void Reset() {
+    for (std::atomic<uint64_t>& bucket : buckets_) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_us_.store(0, std::memory_order_relaxed);
+    max_us_.store(0, std::memory_order_relaxed);
+  }
+
+  // Returns the total number of samples.
+  uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+  // Copies a snapshot of the histogram into |out|.
+  void CopyTo(FlutterDesktopHistogram* out) const {
+    for (size_t i = 0; i < kBucketCount; i++) {
+      out->buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    out->count = count_.load(std::memory_order_relaxed);
+    out->sum_us = sum_us_.load(std::memory_order_relaxed);
+    out->max_us = max_us_.load(std::memory_order_relaxed);
+  }
+
+  // Returns the index of the bucket that |micros| falls into.
+  static size_t BucketIndex(uint64_t micros) {
+    size_t index = 0;
+    while (micros > 0 && index < kBucketCount - 1) {
+      micros >>= 1;
+      index++;
+    }
+    return index;
+  }
+
+ private:
+  std::array<std::atomic<uint64_t>, kBucketCount> buckets_;
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_us_;
+  std::atomic<uint64_t> max_us_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_LATENCY_HISTOGRAM_H_
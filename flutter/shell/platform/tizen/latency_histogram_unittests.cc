@@ -0,0 +1,45 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/latency_histogram.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(LatencyHistogramTest, BucketIndex) {
+  EXPECT_EQ(LatencyHistogram::BucketIndex(0), 0u);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(1), 1u);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(2), 2u);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(3), 2u);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(16666), 15u);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(UINT64_MAX),
+            LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyHistogramTest, RecordAndReset) {
+  LatencyHistogram histogram;
+  histogram.Record(std::chrono::microseconds(3));
+  histogram.Record(std::chrono::milliseconds(2));
+  histogram.Record(std::chrono::nanoseconds(-5));
+
+  FlutterDesktopHistogram snapshot = {};
+  histogram.CopyTo(&snapshot);
+  EXPECT_EQ(snapshot.count, 3u);
+  EXPECT_EQ(snapshot.sum_us, 2003u);
+  EXPECT_EQ(snapshot.max_us, 2000u);
+  EXPECT_EQ(snapshot.buckets[0], 1u);
+  EXPECT_EQ(snapshot.buckets[2], 1u);
+  EXPECT_EQ(snapshot.buckets[11], 1u);
+
+  histogram.Reset();
+  histogram.CopyTo(&snapshot);
+  EXPECT_EQ(snapshot.count, 0u);
+  EXPECT_EQ(snapshot.max_us, 0u);
+  EXPECT_EQ(snapshot.buckets[11], 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
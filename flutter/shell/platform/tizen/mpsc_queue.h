@@ -0,0 +1,90 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_MPSC_QUEUE_H_
+#define EMBEDDER_MPSC_QUEUE_H_
+
+#include <atomic>
+#include <utility>
+
+namespace flutter {
+
+// An unbounded lock-free multi-producer/single-consumer FIFO queue.
+//
+// Push() may be called from any thread. TryPop() must only ever be called
+// from a single consumer thread. A producer that is preempted in the middle
+// of Push() may temporarily hide the values pushed after it from the
+// consumer; callers are expected to signal the consumer after Push() returns
+// so that those values are picked up on a later drain.
+template <typename T>
+class MpscQueue {
+ public:
+  MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+  ~MpscQueue() {
+    T value;
+    while (TryPop(&value)) {
+    }
+    if (tail_ != &stub_) {
+      delete tail_;
+    }
+  }
+
+  // Prevent copying.
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  // Appends |value| to the queue. Safe to call from any thread.
+  void Push(T value) {
+    Node* node = new Node(std::move(value));
+    Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+    // Sequentially consistent so that a producer that inspects consumer state
+    // after Push() and a consumer that calls IsEmpty() after publishing that
+    // state cannot both miss each other.
+    prev->next.store(node);
+  }
+
+  // Returns true if no value is currently visible to the consumer. Must only
+  // be called from the consumer thread.
+  bool IsEmpty() const { return tail_->next.load() == nullptr; }
+
+  // Removes the oldest value from the queue and stores it in |value|.
+  //
+  // Returns false if no value is currently visible to the consumer.
+  bool TryPop(T* value) {
+    Node* tail = tail_;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (!next) {
+      return false;
+    }
+    *value = std::move(next->value);
+    tail_ = next;
+    if (tail != &stub_) {
+      delete tail;
+    }
+    return true;
+  }
+
+ private:
+  struct Node {
+    Node() = default;
+    explicit Node(T v) : value(std::move(v)) {}
+
+    std::atomic<Node*> next = nullptr;
+    T value = {};
+  };
+
+  // The dummy node the queue starts out with.
+  Node stub_;
+
+  // The most recently pushed node. Shared by all producers.
+  std::atomic<Node*> head_;
+
+  // The node preceding the oldest value. Owned by the consumer.
+  Node* tail_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_MPSC_QUEUE_H_
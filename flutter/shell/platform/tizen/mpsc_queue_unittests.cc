@@ -0,0 +1,84 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/mpsc_queue.h"
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(MpscQueueTest, EmptyQueue) {
+  MpscQueue<int> queue;
+  int value = 0;
+  EXPECT_FALSE(queue.TryPop(&value));
+}
+
+TEST(MpscQueueTest, PopsInPushOrder) {
+  MpscQueue<int> queue;
+  queue.Push(1);
+  queue.Push(2);
+  queue.Push(3);
+
+  int value = 0;
+  EXPECT_TRUE(queue.TryPop(&value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(queue.TryPop(&value));
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(queue.TryPop(&value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(queue.TryPop(&value));
+}
+
+TEST(MpscQueueTest, DestroyNonEmptyQueue) {
+  auto queue = std::make_unique<MpscQueue<std::vector<int>>>();
+  queue->Push({1, 2, 3});
+  queue->Push({4, 5, 6});
+  queue.reset();
+  EXPECT_TRUE(true);
+}
+
+TEST(MpscQueueTest, MultipleProducers) {
+  constexpr int kProducerCount = 4;
+  constexpr int kValuesPerProducer = 10000;
+
+  MpscQueue<std::pair<int, int>> queue;
+  std::vector<std::thread> producers;
+  for (int i = 0; i < kProducerCount; i++) {
+    producers.emplace_back([&queue, i]() {
+      for (int j = 0; j < kValuesPerProducer; j++) {
+        queue.Push({i, j});
+      }
+    });
+  }
+
+  // Values from the same producer must come out in the order they were
+  // pushed, and nothing may be lost or duplicated.
+  std::vector<int> next_expected(kProducerCount, 0);
+  int received = 0;
+  while (received < kProducerCount * kValuesPerProducer) {
+    std::pair<int, int> value;
+    if (!queue.TryPop(&value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(value.second, next_expected[value.first]);
+    next_expected[value.first]++;
+    received++;
+  }
+
+  for (std::thread& producer : producers) {
+    producer.join();
+  }
+  std::pair<int, int> value;
+  EXPECT_FALSE(queue.TryPop(&value));
+}
+
+}  // namespace testing
+}  // namespace flutter
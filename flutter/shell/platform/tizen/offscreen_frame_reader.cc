@@ -0,0 +1,289 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/offscreen_frame_reader.h"
+
+#include <GLES2/gl2ext.h>
+
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+OffscreenFrameReader::OffscreenFrameReader(EGLDisplay display,
+                                           EGLConfig config,
+                                           EGLContext share_context,
+                                           int32_t width,
+                                           int32_t height)
+    : display_(display), width_(width), height_(height) {
+  if (width <= 0 || height <= 0) {
+    FT_LOG(Error) << "Invalid offscreen size: " << width << "x" << height;
+    return;
+  }
+
+  const char* extensions = eglQueryString(display_, EGL_EXTENSIONS);
+  if (extensions && strstr(extensions, "EGL_KHR_fence_sync")) {
+    create_sync_ = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(
+        eglGetProcAddress("eglCreateSyncKHR"));
+    client_wait_sync_ = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(
+        eglGetProcAddress("eglClientWaitSyncKHR"));
+    destroy_sync_ = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(
+        eglGetProcAddress("eglDestroySyncKHR"));
+  }
+  if (!create_sync_ || !client_wait_sync_ || !destroy_sync_) {
+    FT_LOG(Info) << "EGL_KHR_fence_sync is not supported. Frames are "
+                    "finished on the raster thread before being read.";
+    create_sync_ = nullptr;
+  }
+
+  const EGLint context_attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+  reader_context_ =
+      eglCreateContext(display_, config, share_context, context_attribs);
+  if (reader_context_ == EGL_NO_CONTEXT) {
+    FT_LOG(Error) << "Could not create a readback context.";
+    return;
+  }
+  const EGLint surface_attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+  reader_surface_ = eglCreatePbufferSurface(display_, config, surface_attribs);
+  if (reader_surface_ == EGL_NO_SURFACE) {
+    FT_LOG(Error) << "Could not create a readback surface.";
+    return;
+  }
+
+  frame_pipe_ = ecore_pipe_add(
+      [](void* data, void* buffer, unsigned int nbyte) -> void {
+        auto* self = static_cast<OffscreenFrameReader*>(data);
+        self->DeliverFrames();
+      },
+      this);
+
+  reader_thread_ = std::thread(&OffscreenFrameReader::Run, this);
+  is_valid_ = true;
+}
+
+OffscreenFrameReader::~OffscreenFrameReader() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  slot_submitted_.notify_all();
+  if (reader_thread_.joinable()) {
+    reader_thread_.join();
+  }
+  if (frame_pipe_) {
+    ecore_pipe_del(frame_pipe_);
+  }
+  for (Slot& slot : slots_) {
+    if (slot.fence != EGL_NO_SYNC_KHR) {
+      destroy_sync_(display_, slot.fence);
+    }
+  }
+  // The objects used by the raster thread are released together with its
+  // context.
+  if (reader_surface_ != EGL_NO_SURFACE) {
+    eglDestroySurface(display_, reader_surface_);
+  }
+  if (reader_context_ != EGL_NO_CONTEXT) {
+    eglDestroyContext(display_, reader_context_);
+  }
+}
+
+void OffscreenFrameReader::SetFrameCallback(FrameCallback callback) {
+  frame_callback_ = std::move(callback);
+  has_frame_callback_ = static_cast<bool>(frame_callback_);
+}
+
+uint32_t OffscreenFrameReader::GetFramebuffer() {
+  Slot& slot = slots_[current_slot_];
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_released_.wait(lock, [&slot] { return !slot.pending; });
+  }
+  if (slot.framebuffer == 0 && !InitializeSlot(&slot)) {
+    return 0;
+  }
+  return slot.framebuffer;
+}
+
+int OffscreenFrameReader::GetBufferAge() {
+  const Slot& slot = slots_[current_slot_];
+  if (slot.frame_number == 0) {
+    return 0;
+  }
+  return static_cast<int>(frame_count_ + 1 - slot.frame_number);
+}
+
+bool OffscreenFrameReader::SubmitFrame() {
+  Slot& slot = slots_[current_slot_];
+  if (slot.framebuffer == 0) {
+    return false;
+  }
+  if (create_sync_) {
+    slot.fence = create_sync_(display_, EGL_SYNC_FENCE_KHR, nullptr);
+    // Make sure the fence is signaled eventually.
+    glFlush();
+  } else {
+    glFinish();
+  }
+  slot.frame_number = ++frame_count_;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot.pending = true;
+    pending_slots_.push_back(current_slot_);
+  }
+  slot_submitted_.notify_one();
+  current_slot_ = (current_slot_ + 1) % kFramebufferCount;
+  return true;
+}
+
+bool OffscreenFrameReader::InitializeSlot(Slot* slot) {
+  glGenTextures(1, &slot->texture);
+  glBindTexture(GL_TEXTURE_2D, slot->texture);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width_, height_, 0, GL_RGBA,
+               GL_UNSIGNED_BYTE, nullptr);
+
+  glGenRenderbuffers(1, &slot->stencil_buffer);
+  glBindRenderbuffer(GL_RENDERBUFFER, slot->stencil_buffer);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_STENCIL_INDEX8, width_, height_);
+
+  glGenFramebuffers(1, &slot->framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, slot->framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         slot->texture, 0);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT,
+                            GL_RENDERBUFFER, slot->stencil_buffer);
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    FT_LOG(Error) << "Could not create a complete framebuffer: " << status;
+    glDeleteFramebuffers(1, &slot->framebuffer);
+    glDeleteRenderbuffers(1, &slot->stencil_buffer);
+    glDeleteTextures(1, &slot->texture);
+    *slot = Slot();
+    return false;
+  }
+  return true;
+}
+
+void OffscreenFrameReader::Run() {
+  if (eglMakeCurrent(display_, reader_surface_, reader_surface_,
+                     reader_context_) != EGL_TRUE) {
+    FT_LOG(Error) << "Could not make the readback context current.";
+  }
+
+  while (true) {
+    size_t index;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      slot_submitted_.wait(lock,
+                           [this] { return quit_ || !pending_slots_.empty(); });
+      if (pending_slots_.empty()) {
+        break;
+      }
+      index = pending_slots_.front();
+      pending_slots_.pop_front();
+    }
+
+    Slot& slot = slots_[index];
+    if (slot.fence != EGL_NO_SYNC_KHR) {
+      client_wait_sync_(display_, slot.fence, 0, EGL_FOREVER_KHR);
+      destroy_sync_(display_, slot.fence);
+      slot.fence = EGL_NO_SYNC_KHR;
+    }
+
+    bool has_frame = false;
+    Frame frame;
+    if (has_frame_callback_) {
+      frame = ReadSlot(&slot);
+      has_frame = !frame.pixels.empty();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      slot.pending = false;
+    }
+    slot_released_.notify_all();
+
+    if (has_frame) {
+      bool needs_wakeup = false;
+      {
+        std::lock_guard<std::mutex> lock(frames_mutex_);
+        // If the main thread stalls, drop the oldest frames rather than
+        // queueing full-size readbacks without bound.
+        while (frames_.size() >= kMaxQueuedFrames) {
+          frames_.pop_front();
+        }
+        needs_wakeup = frames_.empty();
+        frames_.push_back(std::move(frame));
+      }
+      // DeliverFrames() takes all queued frames, so one wakeup is enough.
+      if (needs_wakeup) {
+        ecore_pipe_write(frame_pipe_, nullptr, 0);
+      }
+    }
+  }
+
+  for (Slot& slot : slots_) {
+    if (slot.reader_framebuffer != 0) {
+      glDeleteFramebuffers(1, &slot.reader_framebuffer);
+    }
+  }
+  eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+OffscreenFrameReader::Frame OffscreenFrameReader::ReadSlot(Slot* slot) {
+  Frame frame;
+  if (slot->reader_framebuffer == 0) {
+    glGenFramebuffers(1, &slot->reader_framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, slot->reader_framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, slot->texture, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+      FT_LOG(Error) << "Could not create a readback framebuffer.";
+      glDeleteFramebuffers(1, &slot->reader_framebuffer);
+      slot->reader_framebuffer = 0;
+      return frame;
+    }
+  } else {
+    glBindFramebuffer(GL_FRAMEBUFFER, slot->reader_framebuffer);
+  }
+
+  size_t row_bytes = static_cast<size_t>(width_) * 4;
+  frame.width = width_;
+  frame.height = height_;
+  frame.pixels.resize(row_bytes * height_);
+  glPixelStorei(GL_PACK_ALIGNMENT, 4);
+  glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE,
+               frame.pixels.data());
+
+  // GL rows are bottom-up.
+  std::vector<uint8_t> row(row_bytes);
+  for (int32_t top = 0, bottom = height_ - 1; top < bottom; top++, bottom--) {
+    uint8_t* top_row = frame.pixels.data() + top * row_bytes;
+    uint8_t* bottom_row = frame.pixels.data() + bottom * row_bytes;
+    memcpy(row.data(), top_row, row_bytes);
+    memcpy(top_row, bottom_row, row_bytes);
+    memcpy(bottom_row, row.data(), row_bytes);
+  }
+  return frame;
+}
+
+void OffscreenFrameReader::DeliverFrames() {
+  std::deque<Frame> frames;
+  {
+    std::lock_guard<std::mutex> lock(frames_mutex_);
+    frames.swap(frames_);
+  }
+  if (!frame_callback_) {
+    return;
+  }
+  for (const Frame& frame : frames) {
+    frame_callback_(frame.pixels.data(), frame.width, frame.height);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,155 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_OFFSCREEN_FRAME_READER_H_
+#define EMBEDDER_OFFSCREEN_FRAME_READER_H_
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <Ecore.h>
+#include <GLES2/gl2.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace flutter {
+
+// Provides a ring of framebuffers for offscreen rendering and reads back the
+// frames rendered into them.
+//
+// The raster thread renders into one framebuffer while earlier frames are
+// read back on a dedicated thread with its own context, so neither thread
+// waits for the GPU in the common case. The handoff is synchronized with
+// EGL fences (EGL_KHR_fence_sync). Frames are delivered to the main thread.
+class OffscreenFrameReader {
+ public:
+  // Called on the main thread with the pixels of a frame in RGBA8888 format,
+  // top row first. |pixels| is only valid during the call.
+  using FrameCallback = std::function<
+      void(const uint8_t* pixels, int32_t width, int32_t height)>;
+
+  static constexpr size_t kFramebufferCount = 3;
+
+  // The maximum number of frames read back but not yet delivered to the main
+  // thread. Older frames are dropped when it is exceeded.
+  static constexpr size_t kMaxQueuedFrames = kFramebufferCount;
+
+  // |share_context| is the context that the engine renders with.
+  OffscreenFrameReader(EGLDisplay display,
+                       EGLConfig config,
+                       EGLContext share_context,
+                       int32_t width,
+                       int32_t height);
+  ~OffscreenFrameReader();
+
+  // Prevent copying.
+  OffscreenFrameReader(const OffscreenFrameReader&) = delete;
+  OffscreenFrameReader& operator=(const OffscreenFrameReader&) = delete;
+
+  bool IsValid() const { return is_valid_; }
+
+  int32_t width() const { return width_; }
+  int32_t height() const { return height_; }
+
+  // Sets the callback that receives frames. Must be called on the main
+  // thread.
+  void SetFrameCallback(FrameCallback callback);
+
+  // Returns the framebuffer that the next frame is rendered into. Called on
+  // the raster thread with |share_context| current. Blocks while the
+  // framebuffer is still being read back.
+  uint32_t GetFramebuffer();
+
+  // Returns the number of frames since the framebuffer returned by
+  // GetFramebuffer() was last drawn, or 0 if it has never been drawn. See
+  // EGL_EXT_buffer_age.
+  int GetBufferAge();
+
+  // Hands the frame rendered into the framebuffer returned by
+  // GetFramebuffer() over to the reader thread and advances the ring. Called
+  // on the raster thread.
+  bool SubmitFrame();
+
+ private:
+  struct Slot {
+    GLuint texture = 0;
+    // Framebuffer objects are not shared, so each context has its own.
+    GLuint framebuffer = 0;
+    GLuint stencil_buffer = 0;
+    GLuint reader_framebuffer = 0;
+    EGLSyncKHR fence = EGL_NO_SYNC_KHR;
+    // The number of the frame last drawn into the slot, or 0. Only accessed
+    // on the raster thread.
+    uint64_t frame_number = 0;
+    // Whether the slot has been submitted but not read yet. Guarded by
+    // |mutex_|.
+    bool pending = false;
+  };
+
+  struct Frame {
+    std::vector<uint8_t> pixels;
+    int32_t width;
+    int32_t height;
+  };
+
+  // Allocates the GL objects of |slot| used by the raster thread.
+  bool InitializeSlot(Slot* slot);
+
+  // The body of |reader_thread_|.
+  void Run();
+
+  // Reads |slot| into a new frame. Called on |reader_thread_|.
+  Frame ReadSlot(Slot* slot);
+
+  // Delivers the frames read so far. Called on the main thread.
+  void DeliverFrames();
+
+  EGLDisplay display_ = EGL_NO_DISPLAY;
+  EGLContext reader_context_ = EGL_NO_CONTEXT;
+  EGLSurface reader_surface_ = EGL_NO_SURFACE;
+  int32_t width_ = 0;
+  int32_t height_ = 0;
+  bool is_valid_ = false;
+
+  PFNEGLCREATESYNCKHRPROC create_sync_ = nullptr;
+  PFNEGLCLIENTWAITSYNCKHRPROC client_wait_sync_ = nullptr;
+  PFNEGLDESTROYSYNCKHRPROC destroy_sync_ = nullptr;
+
+  std::array<Slot, kFramebufferCount> slots_;
+  // The slot that is being rendered into. Only accessed on the raster
+  // thread.
+  size_t current_slot_ = 0;
+  // The number of frames submitted. Only accessed on the raster thread.
+  uint64_t frame_count_ = 0;
+
+  // Slots waiting to be read, in submission order.
+  std::deque<size_t> pending_slots_;
+  std::mutex mutex_;
+  std::condition_variable slot_released_;
+  std::condition_variable slot_submitted_;
+  bool quit_ = false;
+  std::thread reader_thread_;
+
+  // Frames waiting to be delivered to the main thread, at most
+  // kMaxQueuedFrames.
+  std::deque<Frame> frames_;
+  std::mutex frames_mutex_;
+  Ecore_Pipe* frame_pipe_ = nullptr;
+
+  // Only accessed on the main thread.
+  FrameCallback frame_callback_;
+  // Whether |frame_callback_| is set. Frames are not read without it.
+  std::atomic<bool> has_frame_callback_ = false;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_OFFSCREEN_FRAME_READER_H_
@@ -0,0 +1,202 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/pixel_buffer_pool.h"
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+std::unique_ptr<PixelBufferPool> PixelBufferPool::Create(
+    const FlutterDesktopPixelBufferPoolTextureConfig& config) {
+  if (config.struct_size < sizeof(FlutterDesktopPixelBufferPoolTextureConfig)) {
+    FT_LOG(Error) << "Invalid pixel buffer pool texture config size.";
+    return nullptr;
+  }
+  if (config.width == 0 || config.height == 0) {
+    FT_LOG(Error) << "Invalid pixel buffer pool size: " << config.width << "x"
+                  << config.height;
+    return nullptr;
+  }
+
+  // DRM formats name the components from the most significant byte of a
+  // little-endian word.
+  tbm_format format;
+  switch (config.format) {
+    case kFlutterDesktopPixelFormatRGBA8888:
+      format = TBM_FORMAT_ABGR8888;
+      break;
+    case kFlutterDesktopPixelFormatBGRA8888:
+      format = TBM_FORMAT_ARGB8888;
+      break;
+    default:
+      FT_LOG(Error) << "Unsupported pixel buffer pool format: "
+                    << config.format;
+      return nullptr;
+  }
+
+  size_t buffer_count = config.buffer_count;
+  if (buffer_count == 0) {
+    buffer_count = kDefaultBufferCount;
+  } else if (buffer_count < kMinBufferCount) {
+    buffer_count = kMinBufferCount;
+  } else if (buffer_count > kMaxBufferCount) {
+    buffer_count = kMaxBufferCount;
+  }
+
+  std::unique_ptr<PixelBufferPool> pool(
+      new PixelBufferPool(config.width, config.height, format));
+  pool->buffers_.resize(buffer_count);
+  for (Buffer& buffer : pool->buffers_) {
+    buffer.surface = tbm_surface_create(config.width, config.height, format);
+    if (!buffer.surface) {
+      FT_LOG(Error) << "Could not allocate a " << config.width << "x"
+                    << config.height << " tbm surface.";
+      return nullptr;
+    }
+  }
+  return pool;
+}
+
+PixelBufferPool::PixelBufferPool(size_t width,
+                                 size_t height,
+                                 tbm_format format)
+    : width_(width), height_(height), format_(format) {
+  descriptor_.struct_size = sizeof(FlutterDesktopGpuSurfaceDescriptor);
+  descriptor_.width = width;
+  descriptor_.height = height;
+  descriptor_.visible_width = width;
+  descriptor_.visible_height = height;
+  descriptor_.format = format == TBM_FORMAT_ABGR8888
+                           ? kFlutterDesktopPixelFormatRGBA8888
+                           : kFlutterDesktopPixelFormatBGRA8888;
+}
+
+PixelBufferPool::~PixelBufferPool() {
+  for (Buffer& buffer : buffers_) {
+    if (!buffer.surface) {
+      continue;
+    }
+    if (buffer.state == BufferState::kWriting) {
+      tbm_surface_unmap(buffer.surface);
+    }
+    tbm_surface_destroy(buffer.surface);
+  }
+}
+
+bool PixelBufferPool::Acquire(FlutterDesktopWritablePixelBuffer* buffer) {
+  Buffer* free_buffer = nullptr;
+  int64_t buffer_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < buffers_.size(); i++) {
+      if (buffers_[i].state == BufferState::kFree) {
+        free_buffer = &buffers_[i];
+        buffer_id = static_cast<int64_t>(i);
+        break;
+      }
+    }
+    if (!free_buffer) {
+      return false;
+    }
+    free_buffer->state = BufferState::kWriting;
+  }
+
+  // Mapping waits for pending GPU access to the surface, so it is done
+  // without holding the lock.
+  tbm_surface_info_s info;
+  if (tbm_surface_map(free_buffer->surface, TBM_SURF_OPTION_WRITE, &info) !=
+      TBM_SURFACE_ERROR_NONE) {
+    FT_LOG(Error) << "Could not map a tbm surface for writing.";
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffer->state = BufferState::kFree;
+    return false;
+  }
+  buffer->buffer = info.planes[0].ptr;
+  buffer->width = width_;
+  buffer->height = height_;
+  buffer->row_bytes = info.planes[0].stride;
+  buffer->buffer_id = buffer_id;
+  return true;
+}
+
+bool PixelBufferPool::Submit(int64_t buffer_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Buffer* buffer = GetWritingBuffer(buffer_id);
+  if (!buffer) {
+    return false;
+  }
+  tbm_surface_unmap(buffer->surface);
+  for (Buffer& other : buffers_) {
+    if (other.state == BufferState::kReady) {
+      other.state = BufferState::kFree;
+    }
+  }
+  buffer->state = BufferState::kReady;
+  return true;
+}
+
+bool PixelBufferPool::Cancel(int64_t buffer_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Buffer* buffer = GetWritingBuffer(buffer_id);
+  if (!buffer) {
+    return false;
+  }
+  tbm_surface_unmap(buffer->surface);
+  buffer->state = BufferState::kFree;
+  return true;
+}
+
+const FlutterDesktopGpuSurfaceDescriptor* PixelBufferPool::GetFrontBuffer() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Buffer* ready = nullptr;
+  for (Buffer& buffer : buffers_) {
+    if (buffer.state == BufferState::kReady) {
+      ready = &buffer;
+      break;
+    }
+  }
+  Buffer* front = nullptr;
+  if (ready) {
+    for (Buffer& buffer : buffers_) {
+      if (buffer.state == BufferState::kRetired) {
+        buffer.state = BufferState::kFree;
+      } else if (buffer.state == BufferState::kFront) {
+        buffer.state = BufferState::kRetired;
+      }
+    }
+    ready->state = BufferState::kFront;
+    front = ready;
+  } else {
+    for (Buffer& buffer : buffers_) {
+      if (buffer.state == BufferState::kFront) {
+        front = &buffer;
+        break;
+      }
+    }
+  }
+  if (!front) {
+    return nullptr;
+  }
+  descriptor_.handle = front->surface;
+  return &descriptor_;
+}
+
+const FlutterDesktopGpuSurfaceDescriptor*
+PixelBufferPool::GetFrontBufferCallback(size_t width,
+                                        size_t height,
+                                        void* user_data) {
+  return static_cast<PixelBufferPool*>(user_data)->GetFrontBuffer();
+}
+
+PixelBufferPool::Buffer* PixelBufferPool::GetWritingBuffer(int64_t buffer_id) {
+  if (buffer_id < 0 || static_cast<size_t>(buffer_id) >= buffers_.size() ||
+      buffers_[buffer_id].state != BufferState::kWriting) {
+    FT_LOG(Error) << "Invalid pixel buffer ID: " << buffer_id;
+    return nullptr;
+  }
+  return &buffers_[buffer_id];
+}
+
+}  // namespace flutter
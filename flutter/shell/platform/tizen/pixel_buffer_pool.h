@@ -0,0 +1,94 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_PIXEL_BUFFER_POOL_H_
+#define EMBEDDER_PIXEL_BUFFER_POOL_H_
+
+#include <tbm_surface.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
+
+namespace flutter {
+
+// A pool of tbm surfaces that clients write pixels into directly.
+//
+// The surfaces are shown through a GPU surface texture, which imports them
+// without copying. A buffer goes through the following states:
+//
+//   free -> writing (Acquire) -> ready (Submit) -> front (GetFrontBuffer)
+//   -> retired -> free
+//
+// A buffer that is replaced as the front buffer is kept retired until the
+// next frame, since the GPU may still be sampling it.
+class PixelBufferPool {
+ public:
+  static constexpr size_t kDefaultBufferCount = 4;
+  static constexpr size_t kMinBufferCount = 3;
+  static constexpr size_t kMaxBufferCount = 8;
+
+  // Returns null if |config| is invalid or the surfaces could not be
+  // allocated.
+  static std::unique_ptr<PixelBufferPool> Create(
+      const FlutterDesktopPixelBufferPoolTextureConfig& config);
+
+  ~PixelBufferPool();
+
+  // Prevent copying.
+  PixelBufferPool(const PixelBufferPool&) = delete;
+  PixelBufferPool& operator=(const PixelBufferPool&) = delete;
+
+  // Maps a free buffer for writing. Returns false if no buffer is free.
+  bool Acquire(FlutterDesktopWritablePixelBuffer* buffer);
+
+  // Unmaps the buffer |buffer_id| and makes it the next front buffer. A
+  // buffer submitted earlier that has not been shown yet is dropped.
+  bool Submit(int64_t buffer_id);
+
+  // Unmaps the buffer |buffer_id| and returns it to the pool.
+  bool Cancel(int64_t buffer_id);
+
+  // Returns the descriptor of the latest submitted buffer, or null if no
+  // buffer has been submitted yet. Called on the raster thread.
+  const FlutterDesktopGpuSurfaceDescriptor* GetFrontBuffer();
+
+  // A FlutterDesktopGpuSurfaceTextureCallback that calls GetFrontBuffer() on
+  // the pool passed as |user_data|.
+  static const FlutterDesktopGpuSurfaceDescriptor*
+  GetFrontBufferCallback(size_t width, size_t height, void* user_data);
+
+ private:
+  enum class BufferState { kFree, kWriting, kReady, kFront, kRetired };
+
+  struct Buffer {
+    tbm_surface_h surface = nullptr;
+    BufferState state = BufferState::kFree;
+  };
+
+  PixelBufferPool(size_t width, size_t height, tbm_format format);
+
+  // Returns the buffer being written with |buffer_id|, or null. Must be
+  // called with |mutex_| held.
+  Buffer* GetWritingBuffer(int64_t buffer_id);
+
+  size_t width_ = 0;
+  size_t height_ = 0;
+  tbm_format format_ = 0;
+
+  std::vector<Buffer> buffers_;
+  std::mutex mutex_;
+
+  // Only accessed on the raster thread.
+  FlutterDesktopGpuSurfaceDescriptor descriptor_ = {};
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_PIXEL_BUFFER_POOL_H_
@@ -0,0 +1,161 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/pixel_buffer_uploader.h"
+
+#include <GLES2/gl2.h>
+
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+PixelBufferUploader::PixelBufferUploader(EGLDisplay display,
+                                         EGLConfig config,
+                                         EGLContext share_context)
+    : display_(display) {
+  const char* extensions = eglQueryString(display_, EGL_EXTENSIONS);
+  if (!extensions || !strstr(extensions, "EGL_KHR_fence_sync")) {
+    FT_LOG(Info) << "EGL_KHR_fence_sync is not supported. Textures are "
+                    "uploaded on the raster thread.";
+    return;
+  }
+  create_sync_ = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(
+      eglGetProcAddress("eglCreateSyncKHR"));
+  client_wait_sync_ = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(
+      eglGetProcAddress("eglClientWaitSyncKHR"));
+  destroy_sync_ = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(
+      eglGetProcAddress("eglDestroySyncKHR"));
+  if (!create_sync_ || !client_wait_sync_ || !destroy_sync_) {
+    FT_LOG(Error) << "Could not resolve the EGL fence functions.";
+    return;
+  }
+  if (strstr(extensions, "EGL_KHR_wait_sync")) {
+    wait_sync_ = reinterpret_cast<PFNEGLWAITSYNCKHRPROC>(
+        eglGetProcAddress("eglWaitSyncKHR"));
+  }
+
+  const EGLint context_attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+  context_ =
+      eglCreateContext(display_, config, share_context, context_attribs);
+  if (context_ == EGL_NO_CONTEXT) {
+    FT_LOG(Error) << "Could not create an upload context.";
+    return;
+  }
+  const EGLint surface_attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+  surface_ = eglCreatePbufferSurface(display_, config, surface_attribs);
+  if (surface_ == EGL_NO_SURFACE) {
+    FT_LOG(Error) << "Could not create an upload surface.";
+    return;
+  }
+
+  thread_ = std::thread(&PixelBufferUploader::Run, this);
+  is_valid_ = true;
+}
+
+PixelBufferUploader::~PixelBufferUploader() {
+  Stop();
+  if (surface_ != EGL_NO_SURFACE) {
+    eglDestroySurface(display_, surface_);
+  }
+  if (context_ != EGL_NO_CONTEXT) {
+    eglDestroyContext(display_, context_);
+  }
+}
+
+bool PixelBufferUploader::PostTask(const void* owner, Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!is_valid_ || quit_) {
+      return false;
+    }
+    tasks_.push_back({owner, std::move(task)});
+  }
+  task_posted_.notify_one();
+  return true;
+}
+
+void PixelBufferUploader::CancelTasks(const void* owner) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (auto iter = tasks_.begin(); iter != tasks_.end();) {
+    if (iter->owner == owner) {
+      iter = tasks_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  task_finished_.wait(lock, [this, owner] { return running_owner_ != owner; });
+}
+
+void PixelBufferUploader::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+    tasks_.clear();
+  }
+  task_posted_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+EGLSyncKHR PixelBufferUploader::CreateFence(bool flush) {
+  EGLSyncKHR fence = create_sync_(display_, EGL_SYNC_FENCE_KHR, nullptr);
+  if (flush) {
+    glFlush();
+  }
+  return fence;
+}
+
+void PixelBufferUploader::WaitAndDestroyFence(EGLSyncKHR fence) {
+  if (fence == EGL_NO_SYNC_KHR) {
+    return;
+  }
+  if (wait_sync_) {
+    wait_sync_(display_, fence, 0);
+  } else {
+    client_wait_sync_(display_, fence, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR,
+                      EGL_FOREVER_KHR);
+  }
+  destroy_sync_(display_, fence);
+}
+
+void PixelBufferUploader::DestroyFence(EGLSyncKHR fence) {
+  if (fence != EGL_NO_SYNC_KHR) {
+    destroy_sync_(display_, fence);
+  }
+}
+
+void PixelBufferUploader::Run() {
+  if (eglMakeCurrent(display_, surface_, surface_, context_) != EGL_TRUE) {
+    FT_LOG(Error) << "Could not make the upload context current.";
+  }
+
+  while (true) {
+    PendingTask pending_task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_posted_.wait(lock, [this] { return quit_ || !tasks_.empty(); });
+      if (quit_) {
+        break;
+      }
+      pending_task = std::move(tasks_.front());
+      tasks_.pop_front();
+      running_owner_ = pending_task.owner;
+    }
+
+    pending_task.task();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_owner_ = nullptr;
+    }
+    task_finished_.notify_all();
+  }
+
+  eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+}  // namespace flutter
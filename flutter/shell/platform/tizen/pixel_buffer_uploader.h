@@ -0,0 +1,97 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_PIXEL_BUFFER_UPLOADER_H_
+#define EMBEDDER_PIXEL_BUFFER_UPLOADER_H_
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace flutter {
+
+// Runs texture uploads on a dedicated thread, off the raster thread.
+//
+// The thread has its own context in the share group of the engine, so the
+// textures it fills can be sampled by the engine once the upload has
+// completed. The handoff is synchronized with EGL fences
+// (EGL_KHR_fence_sync), which the raster thread waits for on the GPU when
+// EGL_KHR_wait_sync is supported.
+class PixelBufferUploader {
+ public:
+  using Task = std::function<void()>;
+
+  // |share_context| is a context of the engine's share group.
+  PixelBufferUploader(EGLDisplay display,
+                      EGLConfig config,
+                      EGLContext share_context);
+  ~PixelBufferUploader();
+
+  // Prevent copying.
+  PixelBufferUploader(const PixelBufferUploader&) = delete;
+  PixelBufferUploader& operator=(const PixelBufferUploader&) = delete;
+
+  bool IsValid() const { return is_valid_; }
+
+  // Runs |task| on the upload thread with the upload context current. Tasks
+  // are identified by |owner| so that they can be cancelled. Returns false
+  // if the uploader has been stopped.
+  bool PostTask(const void* owner, Task task);
+
+  // Discards the pending tasks of |owner| and waits for its running task,
+  // if any, to finish.
+  void CancelTasks(const void* owner);
+
+  // Discards all pending tasks and stops the upload thread. Called before
+  // the contexts of the engine are destroyed.
+  void Stop();
+
+  // Inserts a fence into the command stream of the current context. The
+  // commands are flushed if |flush| is true. Returns EGL_NO_SYNC_KHR on
+  // failure.
+  EGLSyncKHR CreateFence(bool flush);
+
+  // Makes the current context wait for |fence|, on the GPU if possible, and
+  // destroys it.
+  void WaitAndDestroyFence(EGLSyncKHR fence);
+
+  void DestroyFence(EGLSyncKHR fence);
+
+ private:
+  struct PendingTask {
+    const void* owner;
+    Task task;
+  };
+
+  // The body of |thread_|.
+  void Run();
+
+  EGLDisplay display_ = EGL_NO_DISPLAY;
+  EGLContext context_ = EGL_NO_CONTEXT;
+  EGLSurface surface_ = EGL_NO_SURFACE;
+  bool is_valid_ = false;
+
+  PFNEGLCREATESYNCKHRPROC create_sync_ = nullptr;
+  PFNEGLCLIENTWAITSYNCKHRPROC client_wait_sync_ = nullptr;
+  PFNEGLDESTROYSYNCKHRPROC destroy_sync_ = nullptr;
+  PFNEGLWAITSYNCKHRPROC wait_sync_ = nullptr;
+
+  std::deque<PendingTask> tasks_;
+  // The owner of the task being run, or null.
+  const void* running_owner_ = nullptr;
+  std::mutex mutex_;
+  std::condition_variable task_posted_;
+  std::condition_variable task_finished_;
+  bool quit_ = false;
+  std::thread thread_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_PIXEL_BUFFER_UPLOADER_H_
@@ -49,6 +49,35 @@ typedef enum {
   kRunOnSeparateThread,
 } FlutterDesktopUIThreadPolicy;
 
+// Configures the trade-off between latency and power of presenting frames.
+typedef enum {
+  // Default value. Vsync-aligned presentation with a spare image so that a
+  // frame can be prepared while another is displayed.
+  kPresentationBalanced,
+  // Presents the newest frame on the next vsync and discards older ones,
+  // with as few images as possible. Suits interactive UI.
+  kPresentationLowLatency,
+  // Vsync-aligned presentation with deeper buffering, which absorbs uneven
+  // frame times at the cost of latency. Suits video playback.
+  kPresentationPowerSaving,
+} FlutterDesktopPresentationPolicy;
+
+// A buffer of a pixel buffer pool texture that the client writes into.
+typedef struct {
+  // The pixels of the buffer, which are mapped for writing until the buffer
+  // is submitted or canceled.
+  uint8_t* buffer;
+  // Width of the buffer.
+  size_t width;
+  // Height of the buffer.
+  size_t height;
+  // The number of bytes between the starts of consecutive rows. May be
+  // larger than |width| * 4.
+  size_t row_bytes;
+  // Identifies the buffer within its pool.
+  int64_t buffer_id;
+} FlutterDesktopWritablePixelBuffer;
+
 // Properties for configuring the initial settings of a Flutter window.
 typedef struct {
   // The x-coordinate of the top left corner of the window.
@@ -75,6 +104,8 @@ typedef struct {
   bool pointing_device_support;
   // Whether the app should be supported floating menu or not.
   bool floating_menu_support;
+  // The presentation policy of the window. Only used by the Vulkan renderer.
+  FlutterDesktopPresentationPolicy presentation_policy;
 } FlutterDesktopWindowProperties;
 
 // Properties for configuring a Flutter engine instance.
@@ -104,6 +135,92 @@ typedef struct {
   FlutterDesktopUIThreadPolicy ui_thread_policy;
 } FlutterDesktopEngineProperties;
 
+// The number of buckets in a FlutterDesktopHistogram.
+#define FLUTTER_DESKTOP_HISTOGRAM_BUCKET_COUNT 24
+
+// A histogram of durations in microseconds.
+//
+// Bucket 0 counts samples below 1us, bucket i counts samples in
+// [2^(i-1), 2^i) microseconds, and the last bucket counts all samples of
+// 2^(FLUTTER_DESKTOP_HISTOGRAM_BUCKET_COUNT - 2) microseconds or more.
+typedef struct {
+  uint64_t buckets[FLUTTER_DESKTOP_HISTOGRAM_BUCKET_COUNT];
+  // The total number of samples.
+  uint64_t count;
+  // The sum of all samples in microseconds.
+  uint64_t sum_us;
+  // The largest sample in microseconds.
+  uint64_t max_us;
+} FlutterDesktopHistogram;
+
+// Statistics about tasks run on the platform task runner.
+typedef struct {
+  // The size of this struct. Must be sizeof(FlutterDesktopTaskRunnerStats).
+  size_t struct_size;
+  // The time between a task becoming due and starting to run.
+  FlutterDesktopHistogram lateness;
+  // The time spent running each task.
+  FlutterDesktopHistogram execution_time;
+  // The largest number of pending tasks observed at once.
+  uint64_t queue_depth_high_water_mark;
+  // The total number of Ecore timers created for delayed tasks. Counted even
+  // while collection is disabled.
+  uint64_t timers_created;
+  // The total number of times the task runner woke up the main loop.
+  // Counted even while collection is disabled.
+  uint64_t wakeups;
+  // The recent wakeup rate, averaged over at least the last second.
+  double wakeups_per_second;
+} FlutterDesktopTaskRunnerStats;
+
+// Statistics about frames drawn by the engine.
+typedef struct {
+  // The size of this struct. Must be sizeof(FlutterDesktopFrameStats).
+  size_t struct_size;
+  // The number of frames drawn.
+  uint64_t frame_count;
+  // The number of frames that completed after their target vsync time.
+  uint64_t late_frame_count;
+  // The number of vsync intervals missed by late frames.
+  uint64_t dropped_frame_count;
+  // The time between the vsync that started a frame and its presentation.
+  FlutterDesktopHistogram vsync_to_present;
+  // The time spent presenting (swapping) each frame.
+  FlutterDesktopHistogram present_duration;
+  // The time between consecutive frames. Samples above the refresh period
+  // indicate jank.
+  FlutterDesktopHistogram frame_interval;
+  // The GPU time spent rendering each frame. Only collected by the GL
+  // renderer on devices that support GL_EXT_disjoint_timer_query. Samples
+  // lag a few frames behind the other statistics.
+  FlutterDesktopHistogram gpu_time;
+} FlutterDesktopFrameStats;
+
+// A phase of the process startup.
+typedef struct {
+  // The name of the phase. Valid for the lifetime of the process.
+  const char* name;
+  // Monotonic timestamps in microseconds. Equal for instant events such as
+  // "FirstFrame".
+  uint64_t start_us;
+  uint64_t end_us;
+} FlutterDesktopStartupPhase;
+
+// A frame rendered by an offscreen engine.
+typedef struct {
+  // The pixels in RGBA8888 format, top row first. Only valid during the
+  // callback.
+  const uint8_t* pixels;
+  int32_t width;
+  int32_t height;
+  size_t row_bytes;
+} FlutterDesktopOffscreenFrame;
+
+// Called on the main thread for each frame rendered by an offscreen engine.
+typedef void (*FlutterDesktopOffscreenFrameCallback)(
+    const FlutterDesktopOffscreenFrame* frame,
+    void* user_data);
+
 // ========== Engine ==========
 
 // Creates a Flutter engine with the given properties.
@@ -116,6 +233,79 @@ FLUTTER_EXPORT FlutterDesktopEngineRef FlutterDesktopEngineCreate(
 FLUTTER_EXPORT bool FlutterDesktopEngineRun(
     const FlutterDesktopEngineRef engine);
 
+// Initializes the given engine ahead of creating its view.
+//
+// This loads the AOT data and sets up the engine on a worker thread while
+// the view is created with FlutterDesktopViewCreateFromNewWindow, which then
+// waits for the initialization and runs the engine. |renderer_type| must
+// match the renderer type of the view. Only kEGL is currently supported.
+FLUTTER_EXPORT bool FlutterDesktopEngineInitialize(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopRendererType renderer_type);
+
+// Renders the frames of a headless engine offscreen with GL instead of
+// discarding them.
+//
+// Frames of |width| x |height| physical pixels are read back asynchronously
+// and passed to |callback|, if not null. Must be called before the engine is
+// run, and only for engines without a view.
+FLUTTER_EXPORT bool FlutterDesktopEngineSetOffscreenRendering(
+    FlutterDesktopEngineRef engine,
+    int32_t width,
+    int32_t height,
+    double pixel_ratio,
+    FlutterDesktopOffscreenFrameCallback callback,
+    void* user_data);
+
+// Enables or disables collection of platform task runner statistics.
+//
+// Collection is disabled by default, unless the engine was created with the
+// --tizen-task-runner-stats switch. Enabling collection clears any previously
+// collected statistics.
+FLUTTER_EXPORT void FlutterDesktopEngineSetTaskRunnerStatsEnabled(
+    FlutterDesktopEngineRef engine,
+    bool enabled);
+
+// Copies the platform task runner statistics collected so far into |stats|.
+//
+// |stats->struct_size| must be set by the caller. Returns false if collection
+// is disabled. This function can be called from any thread.
+FLUTTER_EXPORT bool FlutterDesktopEngineGetTaskRunnerStats(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopTaskRunnerStats* stats);
+
+// Enables or disables collection of frame statistics.
+//
+// Collection is disabled by default, unless the engine was created with the
+// --tizen-frame-stats switch. Enabling collection clears any previously
+// collected statistics. Must be called on the main thread.
+FLUTTER_EXPORT void FlutterDesktopEngineSetFrameStatsEnabled(
+    FlutterDesktopEngineRef engine,
+    bool enabled);
+
+// Copies the frame statistics collected so far into |stats|.
+//
+// |stats->struct_size| must be set by the caller. Returns false if collection
+// is disabled. This function can be called from any thread.
+FLUTTER_EXPORT bool FlutterDesktopEngineGetFrameStats(
+    FlutterDesktopEngineRef engine,
+    FlutterDesktopFrameStats* stats);
+
+// Copies up to |count| startup phases recorded so far into |phases|, in the
+// order they were recorded. Returns the total number of recorded phases.
+//
+// Phases are recorded from FlutterDesktopEngineCreate up to the first frame.
+FLUTTER_EXPORT size_t FlutterDesktopGetStartupPhases(
+    FlutterDesktopStartupPhase* phases,
+    size_t count);
+
+// Writes the recorded startup phases to |path| in the Chrome trace event
+// format, which can be opened in chrome://tracing or Perfetto.
+//
+// The trace is also written automatically after the first frame if the
+// engine was created with the --tizen-startup-trace <path> switch.
+FLUTTER_EXPORT bool FlutterDesktopWriteStartupTrace(const char* path);
+
 // Shuts down the given engine instance.
 //
 // |engine| is no longer valid after this call.
@@ -181,6 +371,44 @@ FLUTTER_EXPORT void FlutterDesktopViewDestroy(FlutterDesktopViewRef view);
 FLUTTER_EXPORT uint32_t
 FlutterDesktopViewGetResourceId(FlutterDesktopViewRef view);
 
+// Changes the presentation policy of the view. The swapchain is recreated
+// before the next frame. Only supported by the Vulkan renderer.
+FLUTTER_EXPORT void FlutterDesktopViewSetPresentationPolicy(
+    FlutterDesktopViewRef view,
+    FlutterDesktopPresentationPolicy policy);
+
+// ========== Texture Registrar (extensions) ==========
+
+// Acquires a free buffer of the pixel buffer pool texture |texture_id| and
+// maps it for writing.
+//
+// The buffer is the memory that the texture is drawn from, so no copy is
+// made when it is submitted. Returns false if the texture does not exist or
+// all of its buffers are in use. This function can be called from any
+// thread.
+FLUTTER_EXPORT bool FlutterDesktopTextureRegistrarAcquirePixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    FlutterDesktopWritablePixelBuffer* buffer);
+
+// Unmaps |buffer| and makes it the next frame of the texture |texture_id|.
+//
+// |buffer| must have been acquired from the same texture and is no longer
+// valid after this call. This function can be called from any thread.
+FLUTTER_EXPORT bool FlutterDesktopTextureRegistrarSubmitPixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    const FlutterDesktopWritablePixelBuffer* buffer);
+
+// Unmaps |buffer| and returns it to the pool of the texture |texture_id|
+// without showing it.
+//
+// This function can be called from any thread.
+FLUTTER_EXPORT void FlutterDesktopTextureRegistrarCancelPixelBuffer(
+    FlutterDesktopTextureRegistrarRef texture_registrar,
+    int64_t texture_id,
+    const FlutterDesktopWritablePixelBuffer* buffer);
+
 // ========== Plugin Registrar (extensions) ==========
 
 // Returns the view associated with this registrar's engine instance.
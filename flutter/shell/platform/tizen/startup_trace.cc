@@ -0,0 +1,91 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/startup_trace.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace flutter {
+
+namespace {
+
+std::mutex events_mutex;
+std::vector<StartupTraceEvent> events;
+std::atomic<bool> finished = false;
+
+int CurrentThreadId() {
+  return static_cast<int>(syscall(SYS_gettid));
+}
+
+void AddEvent(const char* name, uint64_t start_us, uint64_t end_us) {
+  if (finished.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.push_back({name, start_us, end_us, CurrentThreadId()});
+}
+
+}  // namespace
+
+void StartupTrace::AddPhase(const char* name, uint64_t start_us) {
+  AddEvent(name, start_us, NowMicros());
+}
+
+void StartupTrace::AddInstant(const char* name) {
+  uint64_t now = NowMicros();
+  AddEvent(name, now, now);
+}
+
+bool StartupTrace::Finish() {
+  return !finished.exchange(true);
+}
+
+std::vector<StartupTraceEvent> StartupTrace::GetEvents() {
+  std::lock_guard<std::mutex> lock(events_mutex);
+  return events;
+}
+
+bool StartupTrace::WriteChromeTrace(const std::string& path) {
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    return false;
+  }
+  int pid = static_cast<int>(getpid());
+  file << "{\"traceEvents\":[";
+  bool first = true;
+  for (const StartupTraceEvent& event : GetEvents()) {
+    file << (first ? "\n" : ",\n");
+    first = false;
+    file << "{\"name\":\"" << event.name << "\",\"cat\":\"startup\",";
+    if (event.start_us == event.end_us) {
+      file << "\"ph\":\"i\",\"s\":\"p\",";
+    } else {
+      file << "\"ph\":\"X\",\"dur\":" << event.end_us - event.start_us << ",";
+    }
+    file << "\"ts\":" << event.start_us << ",\"pid\":" << pid
+         << ",\"tid\":" << event.thread_id << "}";
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return file.good();
+}
+
+void StartupTrace::Reset() {
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.clear();
+  finished.store(false);
+}
+
+uint64_t StartupTrace::NowMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace flutter
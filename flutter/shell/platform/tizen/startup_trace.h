@@ -0,0 +1,71 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_STARTUP_TRACE_H_
+#define EMBEDDER_STARTUP_TRACE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flutter {
+
+struct StartupTraceEvent {
+  // A string literal naming the phase.
+  const char* name;
+  // Monotonic timestamps in microseconds. Equal for instant events.
+  uint64_t start_us;
+  uint64_t end_us;
+  // The thread that recorded the event.
+  int thread_id;
+};
+
+// Records the phases of the process startup up to the first frame.
+//
+// The trace is process-wide since it begins before any engine exists.
+// Recording stops once Finish() is called.
+class StartupTrace {
+ public:
+  // Records a phase that started at |start_us| and ends now.
+  static void AddPhase(const char* name, uint64_t start_us);
+
+  // Records an instant event that happens now.
+  static void AddInstant(const char* name);
+
+  // Stops recording. Returns true if this call stopped the recording.
+  static bool Finish();
+
+  // Returns the events recorded so far.
+  static std::vector<StartupTraceEvent> GetEvents();
+
+  // Writes the recorded events to |path| in the Chrome trace event format,
+  // which can be loaded by chrome://tracing and Perfetto.
+  static bool WriteChromeTrace(const std::string& path);
+
+  // Clears all events and restarts recording.
+  static void Reset();
+
+  // Returns the current monotonic time.
+  static uint64_t NowMicros();
+};
+
+// Records the lifetime of this object as a startup phase.
+class StartupTraceScope {
+ public:
+  explicit StartupTraceScope(const char* name)
+      : name_(name), start_us_(StartupTrace::NowMicros()) {}
+  ~StartupTraceScope() { StartupTrace::AddPhase(name_, start_us_); }
+
+  // Prevent copying.
+  StartupTraceScope(const StartupTraceScope&) = delete;
+  StartupTraceScope& operator=(const StartupTraceScope&) = delete;
+
+ private:
+  const char* name_;
+  uint64_t start_us_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_STARTUP_TRACE_H_
@@ -0,0 +1,69 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/startup_trace.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+class StartupTraceTest : public ::testing::Test {
+ protected:
+  void SetUp() { StartupTrace::Reset(); }
+  void TearDown() { StartupTrace::Reset(); }
+};
+
+TEST_F(StartupTraceTest, RecordsPhasesInOrder) {
+  {
+    StartupTraceScope scope("Outer");
+    StartupTrace::AddInstant("Inner");
+  }
+
+  std::vector<StartupTraceEvent> events = StartupTrace::GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_STREQ(events[0].name, "Inner");
+  EXPECT_EQ(events[0].start_us, events[0].end_us);
+  EXPECT_STREQ(events[1].name, "Outer");
+  EXPECT_LE(events[1].start_us, events[0].start_us);
+  EXPECT_GE(events[1].end_us, events[0].end_us);
+}
+
+TEST_F(StartupTraceTest, StopsRecordingWhenFinished) {
+  StartupTrace::AddInstant("FirstFrame");
+  EXPECT_TRUE(StartupTrace::Finish());
+  EXPECT_FALSE(StartupTrace::Finish());
+
+  StartupTrace::AddInstant("Late");
+  EXPECT_EQ(StartupTrace::GetEvents().size(), 1u);
+}
+
+TEST_F(StartupTraceTest, WritesChromeTrace) {
+  StartupTrace::AddPhase("LoadAotData", StartupTrace::NowMicros() - 10);
+  StartupTrace::AddInstant("FirstFrame");
+
+  std::string path = ::testing::TempDir() + "startup_trace.json";
+  ASSERT_TRUE(StartupTrace::WriteChromeTrace(path));
+
+  std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  std::remove(path.c_str());
+
+  std::string json = contents.str();
+  EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(json.find("\"name\":\"LoadAotData\",\"cat\":\"startup\","
+                      "\"ph\":\"X\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"FirstFrame\",\"cat\":\"startup\","
+                      "\"ph\":\"i\""),
+            std::string::npos);
+}
+
+}  // namespace testing
+}  // namespace flutter
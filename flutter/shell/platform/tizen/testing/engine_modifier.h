@@ -23,6 +23,9 @@ class EngineModifier {
   // engine unless overwritten again.
   FlutterEngineProcTable& embedder_api() { return engine_->embedder_api_; }
 
+  // Waits for the initialization started by InitializeEngine(), if any.
+  void JoinInitialization() { engine_->JoinInitialization(); }
+
  private:
   FlutterTizenEngine* engine_;
 };
@@ -0,0 +1,228 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/timer_vsync_waiter.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr uint64_t kNanosPerSecond = 1000000000;
+
+uint64_t MonotonicNowNanos() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * kNanosPerSecond + now.tv_nsec;
+}
+
+}  // namespace
+
+TimerVsyncWaiter::TimerVsyncWaiter(VsyncCallback callback,
+                                   uint64_t period_nanos,
+                                   VblankSource vblank_source)
+    : callback_(std::move(callback)),
+      vblank_source_(std::move(vblank_source)),
+      period_nanos_(period_nanos) {
+  timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+  if (timer_fd_ < 0) {
+    FT_LOG(Error) << "Failed to create a timerfd: " << strerror(errno);
+    FallBackToImmediateDelivery();
+    return;
+  }
+  wakeup_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wakeup_fd_ < 0) {
+    FT_LOG(Error) << "Failed to create an eventfd: " << strerror(errno);
+    FallBackToImmediateDelivery();
+    return;
+  }
+  vsync_thread_ = std::thread(&TimerVsyncWaiter::Run, this);
+}
+
+TimerVsyncWaiter::~TimerVsyncWaiter() {
+  quit_ = true;
+  if (wakeup_fd_ >= 0) {
+    uint64_t value = 1;
+    write(wakeup_fd_, &value, sizeof(value));
+  }
+  if (vsync_thread_.joinable()) {
+    vsync_thread_.join();
+  }
+  if (wakeup_fd_ >= 0) {
+    close(wakeup_fd_);
+  }
+  if (timer_fd_ >= 0) {
+    close(timer_fd_);
+  }
+}
+
+void TimerVsyncWaiter::AsyncWaitForVsync(intptr_t baton) {
+  bool deliver_immediately = false;
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    deliver_immediately = deliver_immediately_;
+    if (!deliver_immediately) {
+      pending_batons_.push_back(baton);
+    }
+  }
+  if (deliver_immediately) {
+    uint64_t frame_start_time_nanos = MonotonicNowNanos();
+    last_vsync_nanos_.store(frame_start_time_nanos);
+    callback_(baton, frame_start_time_nanos,
+              frame_start_time_nanos + period_nanos_.load());
+    return;
+  }
+  uint64_t value = 1;
+  if (write(wakeup_fd_, &value, sizeof(value)) < 0) {
+    FT_LOG(Error) << "Failed to wake up the vsync thread: " << strerror(errno);
+  }
+}
+
+void TimerVsyncWaiter::SetPhase(uint64_t vblank_nanos, uint64_t period_nanos) {
+  if (period_nanos == 0) {
+    return;
+  }
+  phase_nanos_.store(vblank_nanos % period_nanos);
+  period_nanos_.store(period_nanos);
+  ReportPeriod(period_nanos);
+}
+
+uint64_t TimerVsyncWaiter::NextTick(uint64_t now_nanos,
+                                    uint64_t phase_nanos,
+                                    uint64_t period_nanos) {
+  phase_nanos %= period_nanos;
+  if (now_nanos < phase_nanos) {
+    return phase_nanos;
+  }
+  uint64_t elapsed = now_nanos - phase_nanos;
+  return phase_nanos + (elapsed / period_nanos + 1) * period_nanos;
+}
+
+void TimerVsyncWaiter::Run() {
+  uint64_t vblank_nanos = 0;
+  if (vblank_source_ && vblank_source_(&vblank_nanos)) {
+    uint64_t period_nanos = period_nanos_.load();
+    if (period_nanos != 0) {
+      phase_nanos_.store(vblank_nanos % period_nanos);
+    }
+  } else if (vblank_source_) {
+    FT_LOG(Info) << "No vblank to align the vsync timer to.";
+  }
+
+  int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd < 0) {
+    FT_LOG(Error) << "Failed to create an epoll instance: " << strerror(errno);
+    FallBackToImmediateDelivery();
+    return;
+  }
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = wakeup_fd_;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd_, &event);
+  event.data.fd = timer_fd_;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd_, &event);
+
+  while (!quit_) {
+    epoll_event events[2];
+    int count = epoll_wait(epoll_fd, events, 2, -1);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      FT_LOG(Error) << "epoll_wait failed: " << strerror(errno);
+      FallBackToImmediateDelivery();
+      break;
+    }
+
+    bool expired = false;
+    for (int i = 0; i < count; i++) {
+      uint64_t value;
+      if (events[i].data.fd == wakeup_fd_) {
+        read(wakeup_fd_, &value, sizeof(value));
+      } else if (read(timer_fd_, &value, sizeof(value)) > 0) {
+        expired = true;
+      }
+    }
+    if (quit_) {
+      break;
+    }
+
+    if (expired) {
+      uint64_t frame_start_time_nanos = armed_tick_nanos_;
+      armed_tick_nanos_ = 0;
+      DeliverPendingBatons(frame_start_time_nanos);
+    }
+    ArmTimerIfNeeded();
+  }
+
+  close(epoll_fd);
+}
+
+void TimerVsyncWaiter::ArmTimerIfNeeded() {
+  if (armed_tick_nanos_ != 0) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    if (pending_batons_.empty()) {
+      return;
+    }
+  }
+
+  // Never deliver the same tick twice, even if the timer fired early.
+  uint64_t now = std::max(MonotonicNowNanos(), last_vsync_nanos_.load());
+  uint64_t tick = NextTick(now, phase_nanos_.load(), period_nanos_.load());
+
+  itimerspec spec = {};
+  spec.it_value.tv_sec = tick / kNanosPerSecond;
+  spec.it_value.tv_nsec = tick % kNanosPerSecond;
+  if (timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+    FT_LOG(Error) << "timerfd_settime failed: " << strerror(errno);
+    // Deliver the batons now rather than dropping them. The timer is armed
+    // again for the next baton.
+    DeliverPendingBatons(MonotonicNowNanos());
+    return;
+  }
+  armed_tick_nanos_ = tick;
+}
+
+void TimerVsyncWaiter::DeliverPendingBatons(uint64_t frame_start_time_nanos) {
+  last_vsync_nanos_.store(frame_start_time_nanos);
+
+  std::deque<intptr_t> batons;
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    batons.swap(pending_batons_);
+  }
+  uint64_t frame_target_time_nanos =
+      frame_start_time_nanos + period_nanos_.load();
+  for (intptr_t baton : batons) {
+    callback_(baton, frame_start_time_nanos, frame_target_time_nanos);
+  }
+}
+
+void TimerVsyncWaiter::FallBackToImmediateDelivery() {
+  FT_LOG(Error) << "The vsync timer is unavailable, delivering vsync "
+                   "signals immediately.";
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    deliver_immediately_ = true;
+  }
+  DeliverPendingBatons(MonotonicNowNanos());
+}
+
+}  // namespace flutter
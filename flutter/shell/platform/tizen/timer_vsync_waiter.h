@@ -0,0 +1,99 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_TIMER_VSYNC_WAITER_H_
+#define EMBEDDER_TIMER_VSYNC_WAITER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "flutter/shell/platform/tizen/vsync_waiter.h"
+
+namespace flutter {
+
+// Delivers vsync signals to the engine from a timerfd.
+//
+// Ticks are phase-locked to a reference vblank timestamp, i.e. they occur at
+// |phase + n * period| for integer n. Without a reference the ticks are
+// aligned to multiples of the period on the monotonic clock, which makes the
+// frame timing of headless engines reproducible.
+class TimerVsyncWaiter : public VsyncWaiter {
+ public:
+  // Stores the timestamp of a recent vblank in |vblank_nanos| and returns
+  // true, or returns false if no vblank can be observed.
+  using VblankSource = std::function<bool(uint64_t* vblank_nanos)>;
+
+  // If |vblank_source| is set, it is called once on the vsync thread before
+  // the first tick to align the ticks to the display.
+  TimerVsyncWaiter(VsyncCallback callback,
+                   uint64_t period_nanos,
+                   VblankSource vblank_source = nullptr);
+  virtual ~TimerVsyncWaiter();
+
+  void AsyncWaitForVsync(intptr_t baton) override;
+
+  uint64_t GetVsyncPeriodNanos() const override {
+    return period_nanos_.load();
+  }
+
+  uint64_t GetLastVsyncNanos() const override {
+    return last_vsync_nanos_.load();
+  }
+
+  // Aligns the ticks to a vblank that occurred at |vblank_nanos| and changes
+  // the tick interval to |period_nanos|. May be called from any thread.
+  void SetPhase(uint64_t vblank_nanos, uint64_t period_nanos);
+
+  // Returns the first tick strictly after |now_nanos|.
+  static uint64_t NextTick(uint64_t now_nanos,
+                           uint64_t phase_nanos,
+                           uint64_t period_nanos);
+
+ private:
+  // The body of |vsync_thread_|.
+  void Run();
+
+  // Arms |timer_fd_| for the next tick if a baton is pending.
+  void ArmTimerIfNeeded();
+
+  // Delivers the pending batons for a vsync at |frame_start_time_nanos|.
+  void DeliverPendingBatons(uint64_t frame_start_time_nanos);
+
+  // Stops waiting for ticks after an unrecoverable error. The pending batons
+  // and all batons passed to AsyncWaitForVsync() afterwards are delivered
+  // right away, so that the engine never waits for a frame that never comes.
+  void FallBackToImmediateDelivery();
+
+  VsyncCallback callback_;
+  VblankSource vblank_source_;
+
+  std::atomic<uint64_t> period_nanos_;
+  std::atomic<uint64_t> phase_nanos_ = 0;
+  std::atomic<uint64_t> last_vsync_nanos_ = 0;
+
+  // The tick |timer_fd_| is armed for, or 0. Only accessed on
+  // |vsync_thread_|.
+  uint64_t armed_tick_nanos_ = 0;
+
+  // Batons waiting for the next tick.
+  std::deque<intptr_t> pending_batons_;
+  // Whether batons are delivered without waiting for a tick. Guarded by
+  // |pending_batons_mutex_|.
+  bool deliver_immediately_ = false;
+  std::mutex pending_batons_mutex_;
+
+  int timer_fd_ = -1;
+  // An eventfd used to wake up |vsync_thread_|.
+  int wakeup_fd_ = -1;
+  std::atomic<bool> quit_ = false;
+  std::thread vsync_thread_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_TIMER_VSYNC_WAITER_H_
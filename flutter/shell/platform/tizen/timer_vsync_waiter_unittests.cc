@@ -0,0 +1,129 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/timer_vsync_waiter.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Collects the frame start times delivered by a TimerVsyncWaiter.
+class VsyncRecorder {
+ public:
+  VsyncCallback callback() {
+    return [this](intptr_t baton, uint64_t frame_start_time_nanos,
+                  uint64_t frame_target_time_nanos) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      frame_start_times_.push_back(frame_start_time_nanos);
+      cv_.notify_all();
+    };
+  }
+
+  // Waits until |count| vsyncs have been delivered.
+  std::vector<uint64_t> WaitFor(size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, std::chrono::seconds(5),
+                 [&] { return frame_start_times_.size() >= count; });
+    return frame_start_times_;
+  }
+
+ private:
+  std::vector<uint64_t> frame_start_times_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+}  // namespace
+
+TEST(TimerVsyncWaiterTest, NextTickIsAlignedToPhase) {
+  constexpr uint64_t kPeriod = 16000000;
+  constexpr uint64_t kPhase = 3000000;
+
+  EXPECT_EQ(TimerVsyncWaiter::NextTick(0, kPhase, kPeriod), kPhase);
+  EXPECT_EQ(TimerVsyncWaiter::NextTick(kPhase + 1, kPhase, kPeriod),
+            kPhase + kPeriod);
+  EXPECT_EQ(TimerVsyncWaiter::NextTick(100 * kPeriod, kPhase, kPeriod),
+            100 * kPeriod + kPhase);
+}
+
+TEST(TimerVsyncWaiterTest, NextTickIsStrictlyInTheFuture) {
+  constexpr uint64_t kPeriod = 16000000;
+  constexpr uint64_t kPhase = 3000000;
+
+  uint64_t tick = 10 * kPeriod + kPhase;
+  EXPECT_EQ(TimerVsyncWaiter::NextTick(tick, kPhase, kPeriod), tick + kPeriod);
+}
+
+TEST(TimerVsyncWaiterTest, PhaseIsReducedModuloPeriod) {
+  constexpr uint64_t kPeriod = 16000000;
+
+  // A vblank timestamp far in the past still determines the phase.
+  uint64_t vblank = 12345 * kPeriod + 42;
+  EXPECT_EQ(TimerVsyncWaiter::NextTick(50 * kPeriod, vblank, kPeriod),
+            50 * kPeriod + 42);
+}
+
+TEST(TimerVsyncWaiterTest, ReportsOnlyNoticeablePeriodChanges) {
+  TimerVsyncWaiter waiter(nullptr, 16666667);
+  std::vector<uint64_t> reported;
+  waiter.SetPeriodChangedCallback(
+      [&reported](uint64_t period_nanos) { reported.push_back(period_nanos); });
+
+  waiter.SetPhase(0, 16666667);
+  waiter.SetPhase(0, 16700000);
+  waiter.SetPhase(0, 20000000);
+  waiter.SetPhase(0, 8333333);
+
+  EXPECT_EQ(reported, std::vector<uint64_t>({16666667, 20000000, 8333333}));
+  EXPECT_EQ(waiter.GetVsyncPeriodNanos(), 8333333u);
+}
+
+TEST(TimerVsyncWaiterTest, StandaloneTicksAreAlignedToVblankSource) {
+  constexpr uint64_t kPeriod = 10000000;
+  constexpr uint64_t kVblank = 123 * kPeriod + 4321000;
+
+  VsyncRecorder recorder;
+  bool vblank_source_called = false;
+  TimerVsyncWaiter waiter(recorder.callback(), kPeriod,
+                          [&vblank_source_called](uint64_t* vblank_nanos) {
+                            vblank_source_called = true;
+                            *vblank_nanos = kVblank;
+                            return true;
+                          });
+  waiter.AsyncWaitForVsync(1);
+  recorder.WaitFor(1);
+  waiter.AsyncWaitForVsync(2);
+  std::vector<uint64_t> frame_start_times = recorder.WaitFor(2);
+
+  EXPECT_TRUE(vblank_source_called);
+  ASSERT_EQ(frame_start_times.size(), 2u);
+  for (uint64_t frame_start_time : frame_start_times) {
+    EXPECT_EQ(frame_start_time % kPeriod, kVblank % kPeriod);
+  }
+  EXPECT_GT(frame_start_times[1], frame_start_times[0]);
+}
+
+TEST(TimerVsyncWaiterTest, StandaloneTicksWithoutVblankAreAlignedToPeriod) {
+  constexpr uint64_t kPeriod = 10000000;
+
+  VsyncRecorder recorder;
+  TimerVsyncWaiter waiter(recorder.callback(), kPeriod,
+                          [](uint64_t* vblank_nanos) { return false; });
+  waiter.AsyncWaitForVsync(1);
+  std::vector<uint64_t> frame_start_times = recorder.WaitFor(1);
+
+  ASSERT_EQ(frame_start_times.size(), 1u);
+  EXPECT_EQ(frame_start_times[0] % kPeriod, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
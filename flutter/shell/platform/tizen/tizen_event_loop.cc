@@ -5,16 +5,30 @@
 
 #include "tizen_event_loop.h"
 
+#include <limits>
 #include <utility>
 
 namespace flutter {
 
+namespace {
+
+// The value of |armed_deadline_| while no deadline timer is armed.
+constexpr auto kNoDeadline =
+    std::numeric_limits<std::chrono::steady_clock::rep>::max();
+
+}  // namespace
+
 TizenEventLoop::TizenEventLoop(std::thread::id main_thread_id,
                                CurrentTimeProc get_current_time,
-                               TaskExpiredCallback on_task_expired)
+                               TaskExpiredCallback on_task_expired,
+                               TaskTimerMode timer_mode)
     : main_thread_id_(main_thread_id),
       get_current_time_(get_current_time),
-      on_task_expired_(std::move(on_task_expired)) {
+      on_task_expired_(std::move(on_task_expired)),
+      timer_mode_(timer_mode),
+      armed_deadline_(kNoDeadline),
+      rate_window_start_(TaskTimePoint::clock::now()),
+      rate_base_time_(rate_window_start_) {
   ecore_pipe_ = ecore_pipe_add(
       [](void* data, void* buffer, unsigned int nbyte) -> void {
         auto* self = static_cast<TizenEventLoop*>(data);
@@ -24,6 +38,9 @@ TizenEventLoop::TizenEventLoop(std::thread::id main_thread_id,
 }
 
 TizenEventLoop::~TizenEventLoop() {
+  if (deadline_timer_) {
+    ecore_timer_del(deadline_timer_);
+  }
   if (ecore_pipe_) {
     ecore_pipe_del(ecore_pipe_);
   }
@@ -34,24 +51,144 @@ bool TizenEventLoop::RunsTasksOnCurrentThread() const {
 }
 
 void TizenEventLoop::ExecuteTaskEvents() {
+  wakeups_++;
+
+  Task incoming;
+  while (incoming_tasks_.TryPop(&incoming)) {
+    task_queue_.push(incoming);
+  }
+
   const TaskTimePoint now = TaskTimePoint::clock::now();
-  {
-    std::lock_guard<std::mutex> lock1(task_queue_mutex_);
-    std::lock_guard<std::mutex> lock2(expired_tasks_mutex_);
-    while (!task_queue_.empty()) {
-      const Task& top = task_queue_.top();
+  if (now - rate_window_start_ >= std::chrono::seconds(1)) {
+    {
+      std::lock_guard<std::mutex> lock(rate_mutex_);
+      rate_base_time_ = rate_window_start_;
+      rate_base_wakeups_ = rate_window_wakeups_;
+    }
+    rate_window_start_ = now;
+    rate_window_wakeups_ = wakeups_.load();
+  }
 
-      if (top.fire_time > now) {
-        break;
-      }
+  while (!task_queue_.empty()) {
+    const Task& top = task_queue_.top();
+
+    if (top.fire_time > now) {
+      break;
+    }
 
-      expired_tasks_.push_back(task_queue_.top());
-      task_queue_.pop();
+    expired_tasks_.push_back(top);
+    task_queue_.pop();
+  }
+
+  if (stats_enabled_.load(std::memory_order_relaxed)) {
+    uint64_t queue_depth = task_queue_.size() + expired_tasks_.size();
+    if (queue_depth > queue_depth_high_water_mark_.load()) {
+      queue_depth_high_water_mark_.store(queue_depth);
     }
   }
+
+  if (timer_mode_ == TaskTimerMode::kSingleDeadlineTimer) {
+    RearmDeadlineTimer();
+  }
   OnTaskExpired();
 }
 
+void TizenEventLoop::RearmDeadlineTimer() {
+  if (task_queue_.empty()) {
+    if (deadline_timer_) {
+      ecore_timer_freeze(deadline_timer_);
+    }
+    armed_deadline_.store(kNoDeadline);
+  } else {
+    const TaskTimePoint fire_time = task_queue_.top().fire_time;
+    const TaskTimePoint::rep deadline = fire_time.time_since_epoch().count();
+    if (deadline != armed_deadline_.load()) {
+      const double delay =
+          std::chrono::duration<double>(fire_time - TaskTimePoint::clock::now())
+              .count();
+      if (deadline_timer_) {
+        if (ecore_timer_freeze_get(deadline_timer_)) {
+          ecore_timer_thaw(deadline_timer_);
+        }
+        ecore_timer_interval_set(deadline_timer_, delay > 0 ? delay : 0);
+        ecore_timer_reset(deadline_timer_);
+      } else {
+        deadline_timer_ = ecore_timer_add(
+            delay > 0 ? delay : 0,
+            [](void* data) -> Eina_Bool {
+              auto* self = static_cast<TizenEventLoop*>(data);
+              // The timer is deleted on return, so a new one has to be
+              // created by the next re-arm.
+              self->deadline_timer_ = nullptr;
+              self->armed_deadline_.store(kNoDeadline);
+              self->ExecuteTaskEvents();
+              return ECORE_CALLBACK_CANCEL;
+            },
+            this);
+        timers_created_++;
+      }
+      armed_deadline_.store(deadline);
+    }
+  }
+
+  // A task posted after the drain above may have seen the previous deadline
+  // and skipped its wakeup. Pick it up on the next iteration instead.
+  if (!incoming_tasks_.IsEmpty()) {
+    WakeUp();
+  }
+}
+
+TaskTimerStats TizenEventLoop::GetTimerStats() {
+  TaskTimePoint base_time;
+  uint64_t base_wakeups;
+  {
+    std::lock_guard<std::mutex> lock(rate_mutex_);
+    base_time = rate_base_time_;
+    base_wakeups = rate_base_wakeups_;
+  }
+
+  TaskTimerStats stats;
+  stats.timers_created = timers_created_.load();
+  stats.wakeups = wakeups_.load();
+  const double elapsed = std::chrono::duration<double>(
+                             TaskTimePoint::clock::now() - base_time)
+                             .count();
+  if (elapsed > 0 && stats.wakeups >= base_wakeups) {
+    stats.wakeups_per_second = (stats.wakeups - base_wakeups) / elapsed;
+  }
+  return stats;
+}
+
+void TizenEventLoop::SetStatsEnabled(bool enabled) {
+  if (enabled) {
+    lateness_histogram_.Reset();
+    execution_time_histogram_.Reset();
+    queue_depth_high_water_mark_.store(0);
+  }
+  stats_enabled_.store(enabled);
+}
+
+bool TizenEventLoop::GetStats(FlutterDesktopTaskRunnerStats* stats) {
+  if (!stats_enabled_.load()) {
+    return false;
+  }
+  lateness_histogram_.CopyTo(&stats->lateness);
+  execution_time_histogram_.CopyTo(&stats->execution_time);
+  stats->queue_depth_high_water_mark = queue_depth_high_water_mark_.load();
+
+  TaskTimerStats timer_stats = GetTimerStats();
+  stats->timers_created = timer_stats.timers_created;
+  stats->wakeups = timer_stats.wakeups;
+  stats->wakeups_per_second = timer_stats.wakeups_per_second;
+  return true;
+}
+
+void TizenEventLoop::WakeUp() {
+  if (ecore_pipe_) {
+    ecore_pipe_write(ecore_pipe_, nullptr, 0);
+  }
+}
+
 TizenEventLoop::TaskTimePoint TizenEventLoop::TimePointFromFlutterTime(
     uint64_t flutter_target_time_nanos) {
   const TaskTimePoint now = TaskTimePoint::clock::now();
@@ -66,9 +203,15 @@ void TizenEventLoop::PostTask(FlutterTask flutter_task,
   task.order = ++task_order_;
   task.fire_time = TimePointFromFlutterTime(flutter_target_time_nanos);
   task.task = flutter_task;
-  {
-    std::lock_guard<std::mutex> lock(task_queue_mutex_);
-    task_queue_.push(task);
+  incoming_tasks_.Push(task);
+
+  if (timer_mode_ == TaskTimerMode::kSingleDeadlineTimer) {
+    // The armed timer drains the queue anyway, so only tasks due before it
+    // need to wake up the main loop.
+    if (task.fire_time.time_since_epoch().count() < armed_deadline_.load()) {
+      WakeUp();
+    }
+    return;
   }
 
   const double flutter_duration =
@@ -78,36 +221,49 @@ void TizenEventLoop::PostTask(FlutterTask flutter_task,
         flutter_duration / 1000000000.0,
         [](void* data) -> Eina_Bool {
           auto* self = static_cast<TizenEventLoop*>(data);
-          if (self->ecore_pipe_) {
-            ecore_pipe_write(self->ecore_pipe_, nullptr, 0);
-          }
+          self->WakeUp();
           return ECORE_CALLBACK_CANCEL;
         },
         this);
+    timers_created_++;
   } else {
-    if (ecore_pipe_) {
-      ecore_pipe_write(ecore_pipe_, nullptr, 0);
-    }
+    WakeUp();
   }
 }
 
 TizenPlatformEventLoop::TizenPlatformEventLoop(
     std::thread::id main_thread_id,
     CurrentTimeProc get_current_time,
-    TaskExpiredCallback on_task_expired)
-    : TizenEventLoop(main_thread_id, get_current_time, on_task_expired) {}
+    TaskExpiredCallback on_task_expired,
+    TaskTimerMode timer_mode)
+    : TizenEventLoop(main_thread_id,
+                     get_current_time,
+                     on_task_expired,
+                     timer_mode) {}
 
 TizenPlatformEventLoop::~TizenPlatformEventLoop() {}
 
 void TizenPlatformEventLoop::OnTaskExpired() {
-  std::vector<Task> local_expired_tasks;
-  {
-    std::lock_guard<std::mutex> lock(expired_tasks_mutex_);
-    local_expired_tasks = std::move(expired_tasks_);
-  }
+  const TaskTimePoint deadline = TaskTimePoint::clock::now() + time_budget_;
 
-  for (const Task& task : local_expired_tasks) {
-    on_task_expired_(&task.task);
+  while (!expired_tasks_.empty()) {
+    if (time_budget_.count() > 0 && TaskTimePoint::clock::now() >= deadline) {
+      // Yield to Ecore and resume on the next pipe wakeup.
+      WakeUp();
+      break;
+    }
+
+    // The task may re-enter the event loop, so take it out of the queue first.
+    Task task = expired_tasks_.front();
+    expired_tasks_.pop_front();
+    if (stats_enabled_.load(std::memory_order_relaxed)) {
+      const TaskTimePoint start = TaskTimePoint::clock::now();
+      lateness_histogram_.Record(start - task.fire_time);
+      on_task_expired_(&task.task);
+      execution_time_histogram_.Record(TaskTimePoint::clock::now() - start);
+    } else {
+      on_task_expired_(&task.task);
+    }
   }
 }
 
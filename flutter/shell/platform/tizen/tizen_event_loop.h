@@ -17,19 +17,42 @@
 #include <thread>
 
 #include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/tizen/latency_histogram.h"
+#include "flutter/shell/platform/tizen/mpsc_queue.h"
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
 
 namespace flutter {
 
 typedef uint64_t (*CurrentTimeProc)();
 
+// How delayed tasks wake up the main loop.
+enum class TaskTimerMode {
+  // An Ecore timer is added for every task with a future target time.
+  kTimerPerTask,
+  // A single Ecore timer is kept armed for the earliest pending deadline and
+  // re-armed after every drain of the task queue.
+  kSingleDeadlineTimer,
+};
+
+// Counters describing how often the event loop wakes up the main loop.
+struct TaskTimerStats {
+  // The total number of Ecore timers created.
+  uint64_t timers_created = 0;
+  // The total number of times the task queue was drained.
+  uint64_t wakeups = 0;
+  // The recent drain rate, averaged over at least the last second.
+  double wakeups_per_second = 0.0;
+};
+
 class TizenEventLoop {
  public:
   using TaskExpiredCallback = std::function<void(const FlutterTask*)>;
 
   TizenEventLoop(std::thread::id main_thread_id,
                  CurrentTimeProc get_current_time,
-                 TaskExpiredCallback on_task_expired);
+                 TaskExpiredCallback on_task_expired,
+                 TaskTimerMode timer_mode = TaskTimerMode::kTimerPerTask);
   virtual ~TizenEventLoop();
 
   // Prevent copying.
@@ -38,13 +61,30 @@ class TizenEventLoop {
 
   bool RunsTasksOnCurrentThread() const;
 
+  // Moves newly posted tasks into the deadline heap and runs the expired ones.
+  // Must be called on the main thread.
   void ExecuteTaskEvents();
 
   // Post a Flutter engine tasks to the event loop for delayed execution.
+  //
+  // May be called from any thread. The task is handed over to the main thread
+  // through a lock-free queue, so posting never contends with task execution.
   void PostTask(FlutterTask flutter_task, uint64_t flutter_target_time_nanos);
 
   virtual void OnTaskExpired() = 0;
 
+  // Returns the wakeup counters. May be called from any thread.
+  TaskTimerStats GetTimerStats();
+
+  // Enables or disables collection of task latency statistics. Enabling
+  // clears previously collected statistics. May be called from any thread.
+  void SetStatsEnabled(bool enabled);
+
+  // Copies the collected task latency statistics and the wakeup counters
+  // into |stats|. Returns false if collection is disabled. May be called from
+  // any thread.
+  bool GetStats(FlutterDesktopTaskRunnerStats* stats);
+
  protected:
   using TaskTimePoint = std::chrono::steady_clock::time_point;
 
@@ -66,27 +106,86 @@ class TizenEventLoop {
   std::thread::id main_thread_id_;
   CurrentTimeProc get_current_time_;
   TaskExpiredCallback on_task_expired_;
-  std::mutex task_queue_mutex_;
+
+  // Tasks posted from any thread, waiting to be picked up by the main thread.
+  MpscQueue<Task> incoming_tasks_;
+
+  // Tasks ordered by their fire time. Only accessed on the main thread.
   std::priority_queue<Task, std::deque<Task>, Task::Comparer> task_queue_;
-  std::vector<Task> expired_tasks_;
-  std::mutex expired_tasks_mutex_;
+
+  // Tasks that are ready to run, in the order they were posted. Only accessed
+  // on the main thread.
+  std::deque<Task> expired_tasks_;
+
   std::atomic<std::uint64_t> task_order_ = 0;
 
+  // Task latency statistics, collected only while |stats_enabled_| is set.
+  std::atomic<bool> stats_enabled_ = false;
+  LatencyHistogram lateness_histogram_;
+  LatencyHistogram execution_time_histogram_;
+  std::atomic<uint64_t> queue_depth_high_water_mark_ = 0;
+
+  // Wakes up the main loop so that ExecuteTaskEvents() runs soon.
+  void WakeUp();
+
  private:
+  // Arms |deadline_timer_| for the earliest task in |task_queue_|, or disarms
+  // it if the queue is empty. Must be called on the main thread.
+  void RearmDeadlineTimer();
+
   Ecore_Pipe* ecore_pipe_ = nullptr;
 
+  TaskTimerMode timer_mode_;
+
+  // The only timer in use in kSingleDeadlineTimer mode. Only accessed on the
+  // main thread.
+  Ecore_Timer* deadline_timer_ = nullptr;
+
+  // The time |deadline_timer_| is going to fire at, in TaskTimePoint ticks.
+  // Read by posting threads to decide whether a wakeup is needed.
+  std::atomic<TaskTimePoint::rep> armed_deadline_;
+
+  std::atomic<uint64_t> timers_created_ = 0;
+  std::atomic<uint64_t> wakeups_ = 0;
+
+  // The wakeup rate is measured from the start of the previous window, which
+  // the main thread advances at least a second at a time, so that reading it
+  // has no side effects.
+  //
+  // The current window. Only accessed on the main thread.
+  TaskTimePoint rate_window_start_;
+  uint64_t rate_window_wakeups_ = 0;
+  // The previous window. Guarded by |rate_mutex_|.
+  TaskTimePoint rate_base_time_;
+  uint64_t rate_base_wakeups_ = 0;
+  std::mutex rate_mutex_;
+
   // Returns a TaskTimePoint computed from the given target time from Flutter.
   TaskTimePoint TimePointFromFlutterTime(uint64_t flutter_target_time_nanos);
 };
 
 class TizenPlatformEventLoop : public TizenEventLoop {
  public:
-  TizenPlatformEventLoop(std::thread::id main_thread_id,
-                         CurrentTimeProc get_current_time,
-                         TaskExpiredCallback on_task_expired);
+  TizenPlatformEventLoop(
+      std::thread::id main_thread_id,
+      CurrentTimeProc get_current_time,
+      TaskExpiredCallback on_task_expired,
+      TaskTimerMode timer_mode = TaskTimerMode::kTimerPerTask);
   virtual ~TizenPlatformEventLoop();
 
+  // Runs expired tasks in the order they were posted. If |time_budget_| is
+  // exceeded, the remaining tasks are left in |expired_tasks_| and resumed on
+  // the next wakeup so that Ecore can dispatch pending events in between.
   virtual void OnTaskExpired() override;
+
+  // Sets the maximum time spent running tasks per main loop iteration. Zero
+  // (the default) runs all expired tasks at once.
+  void SetTimeBudget(std::chrono::microseconds time_budget) {
+    time_budget_ = time_budget;
+  }
+
+ private:
+  std::chrono::microseconds time_budget_ = std::chrono::microseconds(0);
 };
 
 }  // namespace flutter
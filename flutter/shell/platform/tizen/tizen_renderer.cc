@@ -11,15 +11,27 @@ namespace flutter {
 
 TizenRenderer::TizenRenderer() {}
 
-bool TizenRenderer::CreateSurface(TizenViewBase* view) {
+bool TizenRenderer::GetSurfaceTarget(TizenViewBase* view,
+                                     SurfaceTarget* target) {
   auto* window = dynamic_cast<TizenWindow*>(view);
   if (!window) {
     return false;
   }
   TizenGeometry geometry = view->GetGeometry();
-  return CreateSurface(window->GetRenderTarget(),
-                       window->GetRenderTargetDisplay(), geometry.width,
-                       geometry.height);
+  target->render_target = window->GetRenderTarget();
+  target->render_target_display = window->GetRenderTargetDisplay();
+  target->width = geometry.width;
+  target->height = geometry.height;
+  return true;
+}
+
+bool TizenRenderer::CreateSurface(TizenViewBase* view) {
+  SurfaceTarget target;
+  if (!GetSurfaceTarget(view, &target)) {
+    return false;
+  }
+  return CreateSurface(target.render_target, target.render_target_display,
+                       target.width, target.height);
 }
 
 TizenRenderer::~TizenRenderer() = default;
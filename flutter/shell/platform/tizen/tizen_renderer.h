@@ -8,6 +8,7 @@
 #include <cstdint>
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/frame_stats.h"
 #include "flutter/shell/platform/tizen/tizen_view_base.h"
 
 namespace flutter {
@@ -17,7 +18,16 @@ class TizenRenderer {
   TizenRenderer();
 
   virtual ~TizenRenderer();
-  bool IsValid() { return is_valid_; }
+  // Returns whether the surface has been created. Blocks until the surface
+  // is ready if it is being created asynchronously.
+  bool IsValid() {
+    WaitUntilReady();
+    return is_valid_;
+  }
+
+  // Blocks until the surface is ready to be used. Overridden by renderers
+  // that create their surface on a worker thread.
+  virtual void WaitUntilReady() {}
 
   virtual void ResizeSurface(int32_t width, int32_t height) = 0;
 
@@ -25,7 +35,21 @@ class TizenRenderer {
   virtual std::unique_ptr<ExternalTexture> CreateExternalTexture(
       const FlutterDesktopTextureInfo* texture_info) = 0;
 
+  // Sets the statistics that presented frames are reported to.
+  void SetFrameStats(FrameStats* frame_stats) { frame_stats_ = frame_stats; }
+
  protected:
+  // The parameters of CreateSurface() for a view.
+  struct SurfaceTarget {
+    void* render_target = nullptr;
+    void* render_target_display = nullptr;
+    int32_t width = 0;
+    int32_t height = 0;
+  };
+
+  // Returns false if |view| cannot be rendered to.
+  static bool GetSurfaceTarget(TizenViewBase* view, SurfaceTarget* target);
+
   bool CreateSurface(TizenViewBase* view);
   virtual bool CreateSurface(void* render_target,
                              void* render_target_display,
@@ -33,6 +57,7 @@ class TizenRenderer {
                              int32_t height) = 0;
   virtual void DestroySurface() = 0;
   bool is_valid_ = false;
+  FrameStats* frame_stats_ = nullptr;
 };
 
 }  // namespace flutter
@@ -10,46 +10,110 @@
 #include <GLES2/gl2ext.h>
 #include <tbm_dummy_display.h>
 
+#include <cmath>
+
 #include "flutter/shell/platform/tizen/external_texture_pixel_egl.h"
 #include "flutter/shell/platform/tizen/external_texture_surface_egl.h"
+#include "flutter/shell/platform/tizen/gl_proc_table.h"
 #include "flutter/shell/platform/tizen/logger.h"
+#include "flutter/shell/platform/tizen/startup_trace.h"
 
 namespace flutter {
 
 TizenRendererEgl::TizenRendererEgl(TizenViewBase* view_base,
                                    bool enable_impeller)
     : enable_impeller_(enable_impeller) {
-  TizenRenderer::CreateSurface(view_base);
+  // The window has to be accessed on the main thread.
+  SurfaceTarget target;
+  if (!GetSurfaceTarget(view_base, &target)) {
+    return;
+  }
+  // Setting up EGL does not depend on the engine, so it is done on a worker
+  // thread while the engine starts. The engine waits for it before it first
+  // makes a context current (see WaitUntilReady()).
+  is_surface_ready_ = false;
+  surface_thread_ = std::thread([this, target]() {
+    CreateSurface(target.render_target, target.render_target_display,
+                  target.width, target.height);
+    {
+      std::lock_guard<std::mutex> lock(surface_mutex_);
+      is_surface_ready_ = true;
+    }
+    surface_ready_.notify_all();
+  });
+}
+
+TizenRendererEgl::TizenRendererEgl(int32_t offscreen_width,
+                                   int32_t offscreen_height,
+                                   bool enable_impeller)
+    : enable_impeller_(enable_impeller) {
+  CreateSurface(nullptr, nullptr, offscreen_width, offscreen_height);
 }
 
 TizenRendererEgl::~TizenRendererEgl() {
+  if (surface_thread_.joinable()) {
+    surface_thread_.join();
+  }
   DestroySurface();
 }
 
+void TizenRendererEgl::WaitUntilReady() {
+  if (is_surface_ready_.load(std::memory_order_acquire)) {
+    return;
+  }
+  StartupTraceScope trace_scope("WaitForEGL");
+  std::unique_lock<std::mutex> lock(surface_mutex_);
+  surface_ready_.wait(lock, [this] { return is_surface_ready_.load(); });
+}
+
 std::unique_ptr<ExternalTexture> TizenRendererEgl::CreateExternalTexture(
     const FlutterDesktopTextureInfo* texture_info) {
   switch (texture_info->type) {
     case kFlutterDesktopPixelBufferTexture:
+    case kFlutterDesktopExtendedPixelBufferTexture:
       return std::make_unique<ExternalTexturePixelEGL>(
           texture_info->pixel_buffer_config.callback,
-          texture_info->pixel_buffer_config.user_data);
+          texture_info->pixel_buffer_config.user_data,
+          texture_info->type == kFlutterDesktopExtendedPixelBufferTexture,
+          async_texture_upload_enabled_ ? GetPixelBufferUploader() : nullptr);
     case kFlutterDesktopGpuSurfaceTexture:
       return std::make_unique<ExternalTextureSurfaceEGL>(
           GetExternalTextureExtensionType(),
           texture_info->gpu_surface_config.callback,
           texture_info->gpu_surface_config.user_data);
+    case kFlutterDesktopPixelBufferPoolTexture:
+      // Created as GPU surface textures by the texture registrar.
+      return nullptr;
+  }
+}
+
+std::shared_ptr<PixelBufferUploader>
+TizenRendererEgl::GetPixelBufferUploader() {
+  std::lock_guard<std::mutex> lock(pixel_buffer_uploader_mutex_);
+  if (!pixel_buffer_uploader_created_ && IsValid()) {
+    pixel_buffer_uploader_created_ = true;
+    auto uploader = std::make_shared<PixelBufferUploader>(
+        egl_display_, egl_config_, egl_resource_context_);
+    if (uploader->IsValid()) {
+      pixel_buffer_uploader_ = std::move(uploader);
+    }
   }
+  return pixel_buffer_uploader_;
 }
 
 bool TizenRendererEgl::CreateSurface(void* render_target,
                                      void* render_target_display,
                                      int32_t width,
                                      int32_t height) {
-  if (render_target_display) {
-    egl_display_ =
-        eglGetDisplay(static_cast<wl_display*>(render_target_display));
-  } else {
-    egl_display_ = eglGetDisplay(tbm_dummy_display_create());
+  StartupTraceScope trace_scope("TizenRendererEgl::CreateSurface");
+  {
+    StartupTraceScope scope("eglGetDisplay");
+    if (render_target_display) {
+      egl_display_ =
+          eglGetDisplay(static_cast<wl_display*>(render_target_display));
+    } else {
+      egl_display_ = eglGetDisplay(tbm_dummy_display_create());
+    }
   }
 
   if (egl_display_ == EGL_NO_DISPLAY) {
@@ -65,7 +129,19 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
 
   egl_extension_str_ = eglQueryString(egl_display_, EGL_EXTENSIONS);
 
+  has_buffer_age_ = IsSupportedExtension("EGL_EXT_buffer_age");
+  if (IsSupportedExtension("EGL_KHR_swap_buffers_with_damage")) {
+    swap_buffers_with_damage_ =
+        reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+            eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  } else if (IsSupportedExtension("EGL_EXT_swap_buffers_with_damage")) {
+    swap_buffers_with_damage_ =
+        reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+            eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+  }
+
   {
+    StartupTraceScope scope("eglCreateContext");
     const EGLint attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
 
     egl_context_ =
@@ -86,6 +162,7 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
   }
 
   {
+    StartupTraceScope scope("eglCreateWindowSurface");
     const EGLint attribs[] = {EGL_NONE};
 
     if (render_target_display) {
@@ -94,6 +171,12 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
       egl_surface_ = eglCreateWindowSurface(
           egl_display_, egl_config_,
           reinterpret_cast<EGLNativeWindowType>(egl_window), attribs);
+    } else {
+      // Offscreen frames are rendered into framebuffers, so the surface is
+      // only used to make the context current.
+      const EGLint pbuffer_attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+      egl_surface_ =
+          eglCreatePbufferSurface(egl_display_, egl_config_, pbuffer_attribs);
     }
 
     if (egl_surface_ == EGL_NO_SURFACE) {
@@ -103,6 +186,7 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
   }
 
   {
+    StartupTraceScope scope("eglCreatePbufferSurface");
     const EGLint attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
 
     egl_resource_surface_ =
@@ -113,11 +197,30 @@ bool TizenRendererEgl::CreateSurface(void* render_target,
     }
   }
 
+  if (!render_target_display) {
+    offscreen_frame_reader_ = std::make_unique<OffscreenFrameReader>(
+        egl_display_, egl_config_, egl_context_, width, height);
+    if (!offscreen_frame_reader_->IsValid()) {
+      FT_LOG(Error) << "Could not set up offscreen rendering.";
+      return false;
+    }
+  }
+
   is_valid_ = true;
   return true;
 }
 
 void TizenRendererEgl::DestroySurface() {
+  offscreen_frame_reader_.reset();
+  {
+    std::lock_guard<std::mutex> lock(pixel_buffer_uploader_mutex_);
+    if (pixel_buffer_uploader_) {
+      // Textures keep the uploader alive, but it must not use the share group
+      // after this.
+      pixel_buffer_uploader_->Stop();
+      pixel_buffer_uploader_.reset();
+    }
+  }
   if (egl_display_) {
     eglMakeCurrent(egl_display_, EGL_NO_SURFACE, EGL_NO_SURFACE,
                    EGL_NO_CONTEXT);
@@ -145,14 +248,19 @@ void TizenRendererEgl::DestroySurface() {
     eglTerminate(egl_display_);
     egl_display_ = EGL_NO_DISPLAY;
   }
+  damage_history_.Clear();
 }
 
 bool TizenRendererEgl::ChooseEGLConfiguration() {
-  if (!eglInitialize(egl_display_, nullptr, nullptr)) {
-    PrintEGLError();
-    FT_LOG(Error) << "Could not initialize the EGL display.";
-    return false;
+  {
+    StartupTraceScope scope("eglInitialize");
+    if (!eglInitialize(egl_display_, nullptr, nullptr)) {
+      PrintEGLError();
+      FT_LOG(Error) << "Could not initialize the EGL display.";
+      return false;
+    }
   }
+  StartupTraceScope scope("eglChooseConfig");
 
   if (!eglBindAPI(EGL_OPENGL_ES_API)) {
     PrintEGLError();
@@ -247,6 +355,7 @@ bool TizenRendererEgl::OnMakeCurrent() {
     FT_LOG(Error) << "Could not make the onscreen context current.";
     return false;
   }
+  BeginGpuTimer();
   return true;
 }
 
@@ -276,23 +385,119 @@ bool TizenRendererEgl::OnMakeResourceCurrent() {
   return true;
 }
 
-bool TizenRendererEgl::OnPresent() {
+bool TizenRendererEgl::OnPresentWithInfo(const FlutterPresentInfo* info) {
   if (!IsValid()) {
     return false;
   }
 
-  if (eglSwapBuffers(egl_display_, egl_surface_) != EGL_TRUE) {
+  const FlutterDamage& frame_damage = info->frame_damage;
+  damage_history_.AddFrame(frame_damage);
+
+  EndGpuTimer();
+  if (frame_stats_) {
+    frame_stats_->OnPresentBegin(FrameStats::Now());
+  }
+  EGLBoolean result = EGL_FALSE;
+  if (offscreen_frame_reader_) {
+    result = offscreen_frame_reader_->SubmitFrame() ? EGL_TRUE : EGL_FALSE;
+  } else if (swap_buffers_with_damage_ && frame_damage.num_rects > 0) {
+    // EGL expects the rectangles relative to the bottom-left corner.
+    EGLint width = 0, height = 0;
+    GetSurfaceSize(&width, &height);
+    damage_rects_.clear();
+    for (size_t i = 0; i < frame_damage.num_rects; i++) {
+      const FlutterRect& rect = frame_damage.damage[i];
+      EGLint left = static_cast<EGLint>(std::floor(rect.left));
+      EGLint top = static_cast<EGLint>(std::floor(rect.top));
+      EGLint right = static_cast<EGLint>(std::ceil(rect.right));
+      EGLint bottom = static_cast<EGLint>(std::ceil(rect.bottom));
+      damage_rects_.push_back(left);
+      damage_rects_.push_back(height - bottom);
+      damage_rects_.push_back(right - left);
+      damage_rects_.push_back(bottom - top);
+    }
+    result = swap_buffers_with_damage_(egl_display_, egl_surface_,
+                                       damage_rects_.data(),
+                                       frame_damage.num_rects);
+  } else {
+    result = eglSwapBuffers(egl_display_, egl_surface_);
+  }
+  if (result != EGL_TRUE) {
     PrintEGLError();
     FT_LOG(Error) << "Could not swap EGL buffers.";
     return false;
   }
+  if (frame_stats_) {
+    frame_stats_->OnPresentEnd(FrameStats::Now());
+  }
   return true;
 }
 
+void TizenRendererEgl::OnPopulateExistingDamage(
+    intptr_t fbo_id,
+    FlutterDamage* existing_damage) {
+  existing_damage->struct_size = sizeof(FlutterDamage);
+  existing_damage->num_rects = 1;
+  existing_damage->damage = &existing_damage_;
+
+  // The onscreen surface is current at this point, so its back buffer is
+  // the one the next frame will be drawn into.
+  EGLint buffer_age = 0;
+  if (offscreen_frame_reader_) {
+    buffer_age = offscreen_frame_reader_->GetBufferAge();
+  } else if (has_buffer_age_ &&
+             eglQuerySurface(egl_display_, egl_surface_, EGL_BUFFER_AGE_EXT,
+                             &buffer_age) != EGL_TRUE) {
+    buffer_age = 0;
+  }
+  if (!damage_history_.GetExistingDamage(buffer_age, &existing_damage_)) {
+    EGLint width = 0, height = 0;
+    GetSurfaceSize(&width, &height);
+    existing_damage_ = FlutterRect{0, 0, static_cast<double>(width),
+                                   static_cast<double>(height)};
+  }
+}
+
+void TizenRendererEgl::GetSurfaceSize(EGLint* width, EGLint* height) {
+  if (offscreen_frame_reader_) {
+    *width = offscreen_frame_reader_->width();
+    *height = offscreen_frame_reader_->height();
+    return;
+  }
+  eglQuerySurface(egl_display_, egl_surface_, EGL_WIDTH, width);
+  eglQuerySurface(egl_display_, egl_surface_, EGL_HEIGHT, height);
+}
+
+void TizenRendererEgl::BeginGpuTimer() {
+  if (!frame_stats_ || !frame_stats_->IsEnabled()) {
+    return;
+  }
+  if (!gpu_timer_checked_) {
+    gpu_timer_checked_ = true;
+    FrameStats* frame_stats = frame_stats_;
+    gpu_timer_ = GpuTimer::Create([frame_stats](uint64_t elapsed_nanos) {
+      frame_stats->OnGpuTime(elapsed_nanos);
+    });
+  }
+  if (gpu_timer_) {
+    gpu_timer_->BeginFrame();
+  }
+}
+
+void TizenRendererEgl::EndGpuTimer() {
+  // The query belongs to the onscreen context.
+  if (gpu_timer_ && eglGetCurrentContext() == egl_context_) {
+    gpu_timer_->EndFrame();
+  }
+}
+
 uint32_t TizenRendererEgl::OnGetFBO() {
   if (!IsValid()) {
     return 999;
   }
+  if (offscreen_frame_reader_) {
+    return offscreen_frame_reader_->GetFramebuffer();
+  }
   return 0;
 }
 
@@ -333,133 +538,39 @@ void TizenRendererEgl::ResizeSurface(int32_t width, int32_t height) {
   // Do nothing.
 }
 
+FlutterRendererConfig TizenRendererEgl::GetRendererConfig() {
+  FlutterRendererConfig config = TizenRendererGL::GetRendererConfig();
+  if (offscreen_frame_reader_) {
+    // Every frame is rendered into the next framebuffer of the ring.
+    config.open_gl.fbo_reset_after_present = true;
+  }
+  return config;
+}
+
+void TizenRendererEgl::SetOffscreenFrameCallback(
+    OffscreenFrameReader::FrameCallback callback) {
+  if (offscreen_frame_reader_) {
+    offscreen_frame_reader_->SetFrameCallback(std::move(callback));
+  }
+}
+
 void* TizenRendererEgl::OnProcResolver(const char* name) {
-  auto address = eglGetProcAddress(name);
-  if (address != nullptr) {
-    return reinterpret_cast<void*>(address);
-  }
-#define GL_FUNC(FunctionName)                     \
-  else if (strcmp(name, #FunctionName) == 0) {    \
-    return reinterpret_cast<void*>(FunctionName); \
-  }
-  GL_FUNC(eglGetCurrentDisplay)
-  GL_FUNC(eglQueryString)
-  GL_FUNC(glActiveTexture)
-  GL_FUNC(glAttachShader)
-  GL_FUNC(glBindAttribLocation)
-  GL_FUNC(glBindBuffer)
-  GL_FUNC(glBindFramebuffer)
-  GL_FUNC(glBindRenderbuffer)
-  GL_FUNC(glBindTexture)
-  GL_FUNC(glBlendColor)
-  GL_FUNC(glBlendEquation)
-  GL_FUNC(glBlendFunc)
-  GL_FUNC(glBufferData)
-  GL_FUNC(glBufferSubData)
-  GL_FUNC(glCheckFramebufferStatus)
-  GL_FUNC(glClear)
-  GL_FUNC(glClearColor)
-  GL_FUNC(glClearStencil)
-  GL_FUNC(glColorMask)
-  GL_FUNC(glCompileShader)
-  GL_FUNC(glCompressedTexImage2D)
-  GL_FUNC(glCompressedTexSubImage2D)
-  GL_FUNC(glCopyTexSubImage2D)
-  GL_FUNC(glCreateProgram)
-  GL_FUNC(glCreateShader)
-  GL_FUNC(glCullFace)
-  GL_FUNC(glDeleteBuffers)
-  GL_FUNC(glDeleteFramebuffers)
-  GL_FUNC(glDeleteProgram)
-  GL_FUNC(glDeleteRenderbuffers)
-  GL_FUNC(glDeleteShader)
-  GL_FUNC(glDeleteTextures)
-  GL_FUNC(glDepthMask)
-  GL_FUNC(glDisable)
-  GL_FUNC(glDisableVertexAttribArray)
-  GL_FUNC(glDrawArrays)
-  GL_FUNC(glDrawElements)
-  GL_FUNC(glEnable)
-  GL_FUNC(glEnableVertexAttribArray)
-  GL_FUNC(glFinish)
-  GL_FUNC(glFlush)
-  GL_FUNC(glFramebufferRenderbuffer)
-  GL_FUNC(glFramebufferTexture2D)
-  GL_FUNC(glFrontFace)
-  GL_FUNC(glGenBuffers)
-  GL_FUNC(glGenerateMipmap)
-  GL_FUNC(glGenFramebuffers)
-  GL_FUNC(glGenRenderbuffers)
-  GL_FUNC(glGenTextures)
-  GL_FUNC(glGetBufferParameteriv)
-  GL_FUNC(glGetError)
-  GL_FUNC(glGetFloatv)
-  GL_FUNC(glGetFramebufferAttachmentParameteriv)
-  GL_FUNC(glGetIntegerv)
-  GL_FUNC(glGetProgramInfoLog)
-  GL_FUNC(glGetProgramiv)
-  GL_FUNC(glGetRenderbufferParameteriv)
-  GL_FUNC(glGetShaderInfoLog)
-  GL_FUNC(glGetShaderiv)
-  GL_FUNC(glGetShaderPrecisionFormat)
-  GL_FUNC(glGetString)
-  GL_FUNC(glGetUniformLocation)
-  GL_FUNC(glIsTexture)
-  GL_FUNC(glLineWidth)
-  GL_FUNC(glLinkProgram)
-  GL_FUNC(glPixelStorei)
-  GL_FUNC(glReadPixels)
-  GL_FUNC(glRenderbufferStorage)
-  GL_FUNC(glScissor)
-  GL_FUNC(glShaderSource)
-  GL_FUNC(glStencilFunc)
-  GL_FUNC(glStencilFuncSeparate)
-  GL_FUNC(glStencilMask)
-  GL_FUNC(glStencilMaskSeparate)
-  GL_FUNC(glStencilOp)
-  GL_FUNC(glStencilOpSeparate)
-  GL_FUNC(glTexImage2D)
-  GL_FUNC(glTexParameterf)
-  GL_FUNC(glTexParameterfv)
-  GL_FUNC(glTexParameteri)
-  GL_FUNC(glTexParameteriv)
-  GL_FUNC(glTexSubImage2D)
-  GL_FUNC(glUniform1f)
-  GL_FUNC(glUniform1fv)
-  GL_FUNC(glUniform1i)
-  GL_FUNC(glUniform1iv)
-  GL_FUNC(glUniform2f)
-  GL_FUNC(glUniform2fv)
-  GL_FUNC(glUniform2i)
-  GL_FUNC(glUniform2iv)
-  GL_FUNC(glUniform3f)
-  GL_FUNC(glUniform3fv)
-  GL_FUNC(glUniform3i)
-  GL_FUNC(glUniform3iv)
-  GL_FUNC(glUniform4f)
-  GL_FUNC(glUniform4fv)
-  GL_FUNC(glUniform4i)
-  GL_FUNC(glUniform4iv)
-  GL_FUNC(glUniformMatrix2fv)
-  GL_FUNC(glUniformMatrix3fv)
-  GL_FUNC(glUniformMatrix4fv)
-  GL_FUNC(glUseProgram)
-  GL_FUNC(glVertexAttrib1f)
-  GL_FUNC(glVertexAttrib2fv)
-  GL_FUNC(glVertexAttrib3fv)
-  GL_FUNC(glVertexAttrib4fv)
-  GL_FUNC(glVertexAttribPointer)
-  GL_FUNC(glViewport)
-#define GL_FUNC_EXT(ExtFunctionName, FunctionName)                    \
-  else if (strcmp(name, #ExtFunctionName) == 0) {                     \
-    return reinterpret_cast<void*>(eglGetProcAddress(#FunctionName)); \
-  }
-  GL_FUNC_EXT(glMultiDrawArraysIndirectEXT, glMultiDrawArraysIndirect)
-  GL_FUNC_EXT(glMultiDrawElementsIndirectEXT, glMultiDrawElementsIndirect)
-#undef GL_FUNC_EXT
-#undef GL_FUNC
-
-  FT_LOG(Warn) << "Could not resolve: " << name;
-  return nullptr;
+  // The engine resolves the same functions for every context it creates.
+  std::lock_guard<std::mutex> lock(proc_addresses_mutex_);
+  auto iter = proc_addresses_.find(name);
+  if (iter != proc_addresses_.end()) {
+    return iter->second;
+  }
+
+  void* address = reinterpret_cast<void*>(eglGetProcAddress(name));
+  if (address == nullptr) {
+    address = GlProcTable::Lookup(name);
+  }
+  if (address == nullptr) {
+    FT_LOG(Warn) << "Could not resolve: " << name;
+  }
+  proc_addresses_.emplace(name, address);
+  return address;
 }
+
 }  // namespace flutter
@@ -6,10 +6,22 @@
 #define EMBEDDER_TIZEN_RENDERER_EGL_H_
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include "flutter/shell/platform/tizen/damage_history.h"
 #include "flutter/shell/platform/tizen/external_texture.h"
+#include "flutter/shell/platform/tizen/gpu_timer.h"
+#include "flutter/shell/platform/tizen/offscreen_frame_reader.h"
+#include "flutter/shell/platform/tizen/pixel_buffer_uploader.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
 #include "flutter/shell/platform/tizen/tizen_renderer_gl.h"
 #include "flutter/shell/platform/tizen/tizen_view_base.h"
@@ -18,17 +30,31 @@ namespace flutter {
 
 class TizenRendererEgl : public TizenRendererGL {
  public:
+  // Creates a renderer for |view_base|. The EGL surface is created
+  // asynchronously.
   explicit TizenRendererEgl(TizenViewBase* view_base, bool enable_impeller);
 
+  // Creates a renderer without a window that renders offscreen frames of the
+  // given size. See SetOffscreenFrameCallback().
+  TizenRendererEgl(int32_t offscreen_width,
+                   int32_t offscreen_height,
+                   bool enable_impeller);
+
   virtual ~TizenRendererEgl();
 
+  void WaitUntilReady() override;
+
   virtual bool OnMakeCurrent() override;
 
   virtual bool OnClearCurrent() override;
 
   virtual bool OnMakeResourceCurrent() override;
 
-  virtual bool OnPresent() override;
+  virtual bool OnPresentWithInfo(const FlutterPresentInfo* info) override;
+
+  virtual void OnPopulateExistingDamage(
+      intptr_t fbo_id,
+      FlutterDamage* existing_damage) override;
 
   virtual uint32_t OnGetFBO() override;
 
@@ -38,6 +64,18 @@ class TizenRendererEgl : public TizenRendererGL {
 
   virtual void ResizeSurface(int32_t width, int32_t height) override;
 
+  FlutterRendererConfig GetRendererConfig() override;
+
+  // Enables uploading pixel buffer textures on a dedicated thread. Must be
+  // called before any texture is created.
+  void SetAsyncTextureUploadEnabled(bool enabled) {
+    async_texture_upload_enabled_ = enabled;
+  }
+
+  // Sets the callback that receives the frames of an offscreen renderer.
+  // Must be called on the main thread.
+  void SetOffscreenFrameCallback(OffscreenFrameReader::FrameCallback callback);
+
   virtual std::unique_ptr<ExternalTexture> CreateExternalTexture(
       const FlutterDesktopTextureInfo* texture_info) override;
 
@@ -54,6 +92,18 @@ class TizenRendererEgl : public TizenRendererGL {
 
   void PrintEGLError();
 
+  // Returns the shared uploader of pixel buffer textures, creating it on
+  // first use. Returns null if it is not supported.
+  std::shared_ptr<PixelBufferUploader> GetPixelBufferUploader();
+
+  // Returns the size of the onscreen surface in pixels.
+  void GetSurfaceSize(EGLint* width, EGLint* height);
+
+  // Starts or stops measuring the GPU time of a frame if frame statistics
+  // are enabled. Called with the onscreen context current.
+  void BeginGpuTimer();
+  void EndGpuTimer();
+
   EGLConfig egl_config_ = nullptr;
   EGLDisplay egl_display_ = EGL_NO_DISPLAY;
   EGLContext egl_context_ = EGL_NO_CONTEXT;
@@ -61,7 +111,42 @@ class TizenRendererEgl : public TizenRendererGL {
   EGLContext egl_resource_context_ = EGL_NO_CONTEXT;
   EGLSurface egl_resource_surface_ = EGL_NO_SURFACE;
 
+  // Creates the surface of a view. The EGL objects above are only accessed
+  // after WaitUntilReady().
+  std::thread surface_thread_;
+  std::mutex surface_mutex_;
+  std::condition_variable surface_ready_;
+  std::atomic<bool> is_surface_ready_ = true;
+
   std::string egl_extension_str_;
+
+  // Memoized results of OnProcResolver(), including failed lookups.
+  std::unordered_map<std::string, void*> proc_addresses_;
+  std::mutex proc_addresses_mutex_;
+
+  bool async_texture_upload_enabled_ = false;
+  // Shared with the textures that use it, which may outlive the renderer.
+  std::shared_ptr<PixelBufferUploader> pixel_buffer_uploader_;
+  bool pixel_buffer_uploader_created_ = false;
+  std::mutex pixel_buffer_uploader_mutex_;
+
+  // Only set for offscreen renderers.
+  std::unique_ptr<OffscreenFrameReader> offscreen_frame_reader_;
+
+  // Partial repaint support. Only accessed on the raster thread after the
+  // surface has been created.
+  bool has_buffer_age_ = false;
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage_ = nullptr;
+  DamageHistory damage_history_;
+  FlutterRect existing_damage_ = {};
+  std::vector<EGLint> damage_rects_;
+
+  // Measures the GPU time of frames from the first OnMakeCurrent() after a
+  // frame is presented until the next one is. Only accessed on the raster
+  // thread.
+  std::unique_ptr<GpuTimer> gpu_timer_;
+  bool gpu_timer_checked_ = false;
+
   bool enable_impeller_;
 };
 
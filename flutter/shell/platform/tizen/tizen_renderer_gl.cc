@@ -13,19 +13,23 @@ namespace flutter {
 TizenRendererGL::TizenRendererGL() {}
 
 FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
+  return CreateRendererConfig();
+}
+
+FlutterRendererConfig TizenRendererGL::CreateRendererConfig() {
   FlutterRendererConfig config = {};
   config.type = kOpenGL;
   config.open_gl.struct_size = sizeof(config.open_gl);
   config.open_gl.make_current = [](void* user_data) -> bool {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return false;
     }
     return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnMakeCurrent();
   };
   config.open_gl.make_resource_current = [](void* user_data) -> bool {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return false;
     }
     return dynamic_cast<TizenRendererGL*>(engine->renderer())
@@ -33,25 +37,39 @@ FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
   };
   config.open_gl.clear_current = [](void* user_data) -> bool {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return false;
     }
     return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnClearCurrent();
   };
-  config.open_gl.present = [](void* user_data) -> bool {
+  config.open_gl.present_with_info =
+      [](void* user_data, const FlutterPresentInfo* info) -> bool {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return false;
     }
-    return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnPresent();
+    return dynamic_cast<TizenRendererGL*>(engine->renderer())
+        ->OnPresentWithInfo(info);
   };
   config.open_gl.fbo_callback = [](void* user_data) -> uint32_t {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return false;
     }
     return dynamic_cast<TizenRendererGL*>(engine->renderer())->OnGetFBO();
   };
+  config.open_gl.populate_existing_damage =
+      [](void* user_data, intptr_t fbo_id, FlutterDamage* existing_damage) {
+    auto* engine = static_cast<FlutterTizenEngine*>(user_data);
+    if (!engine->renderer()) {
+      // Having no damage forces a full repaint.
+      existing_damage->num_rects = 0;
+      existing_damage->damage = nullptr;
+      return;
+    }
+    dynamic_cast<TizenRendererGL*>(engine->renderer())
+        ->OnPopulateExistingDamage(fbo_id, existing_damage);
+  };
   config.open_gl.surface_transformation =
       [](void* user_data) -> FlutterTransformation {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
@@ -63,7 +81,7 @@ FlutterRendererConfig TizenRendererGL::GetRendererConfig() {
   config.open_gl.gl_proc_resolver = [](void* user_data,
                                        const char* name) -> void* {
     auto* engine = static_cast<FlutterTizenEngine*>(user_data);
-    if (!engine->view()) {
+    if (!engine->renderer()) {
       return nullptr;
     }
     return dynamic_cast<TizenRendererGL*>(engine->renderer())
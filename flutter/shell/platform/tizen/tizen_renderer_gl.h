@@ -24,7 +24,14 @@ class TizenRendererGL : public TizenRenderer {
 
   virtual bool OnMakeResourceCurrent() = 0;
 
-  virtual bool OnPresent() = 0;
+  // Presents the current frame. |info| describes the area of the frame that
+  // has changed since the previous frame.
+  virtual bool OnPresentWithInfo(const FlutterPresentInfo* info) = 0;
+
+  // Fills |existing_damage| with the area of the buffer |fbo_id| that is out
+  // of date and has to be repainted in addition to the frame damage.
+  virtual void OnPopulateExistingDamage(intptr_t fbo_id,
+                                        FlutterDamage* existing_damage) = 0;
 
   virtual uint32_t OnGetFBO() = 0;
 
@@ -34,6 +41,11 @@ class TizenRendererGL : public TizenRenderer {
 
   FlutterRendererConfig GetRendererConfig() override;
 
+  // Returns the renderer config for GL renderers. The callbacks look up the
+  // renderer through the engine passed as user data, so the config can be
+  // created before the renderer exists.
+  static FlutterRendererConfig CreateRendererConfig();
+
   ExternalTextureExtensionType GetExternalTextureExtensionType();
 };
 
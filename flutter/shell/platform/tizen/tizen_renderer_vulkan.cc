@@ -40,7 +40,12 @@ void DestroyDebugUtilsMessengerEXT(VkInstance instance,
   }
 }
 
-TizenRendererVulkan::TizenRendererVulkan(TizenViewBase* view) {
+TizenRendererVulkan::TizenRendererVulkan(
+    TizenViewBase* view,
+    uint32_t frames_in_flight,
+    FlutterDesktopPresentationPolicy presentation_policy)
+    : frames_(std::clamp(frames_in_flight, 1u, kMaxFramesInFlight)),
+      presentation_policy_(presentation_policy) {
   if (volkInitialize() != VK_SUCCESS) {
     FT_LOG(Error) << "Failed to initialize volk";
     return;
@@ -81,15 +86,11 @@ bool TizenRendererVulkan::InitVulkan(TizenViewBase* view) {
     FT_LOG(Error) << "Failed to get device queue";
     return false;
   }
-  if (!CreateSemaphore()) {
-    FT_LOG(Error) << "Failed to create semaphore";
+  if (!CreateFrameSyncObjects()) {
+    FT_LOG(Error) << "Failed to create frame synchronization objects";
     return false;
   }
-  if (!CreateFence()) {
-    FT_LOG(Error) << "Failed to create fence";
-    return false;
-  }
-  if (!CreateCommandPool()) {
+  if (!CreateCommandPool() || !CreateTransferCommandPool()) {
     FT_LOG(Error) << "Failed to create command pool";
     return false;
   }
@@ -115,8 +116,21 @@ void TizenRendererVulkan::Cleanup() {
       swapchain_ = VK_NULL_HANDLE;
     }
     DestroyCommandPool();
-    vkDestroyFence(logical_device_, image_ready_fence_, nullptr);
-    vkDestroySemaphore(logical_device_, present_transition_semaphore_, nullptr);
+    DestroyRetiredImages(std::numeric_limits<uint64_t>::max());
+    {
+      std::lock_guard<std::mutex> lock(transfer_mutex_);
+      RetireTransfers();
+      for (VkFence fence : free_transfer_fences_) {
+        vkDestroyFence(logical_device_, fence, nullptr);
+      }
+      free_transfer_fences_.clear();
+      if (transfer_command_pool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(logical_device_, transfer_command_pool_, nullptr);
+        transfer_command_pool_ = VK_NULL_HANDLE;
+      }
+    }
+    DestroyPresentSemaphores();
+    DestroyFrameSyncObjects();
     vkDestroyDevice(logical_device_, nullptr);
     logical_device_ = VK_NULL_HANDLE;
   }
@@ -134,13 +148,19 @@ std::unique_ptr<ExternalTexture> TizenRendererVulkan::CreateExternalTexture(
     const FlutterDesktopTextureInfo* texture_info) {
   switch (texture_info->type) {
     case kFlutterDesktopPixelBufferTexture:
+    case kFlutterDesktopExtendedPixelBufferTexture:
       return std::make_unique<ExternalTexturePixelVulkan>(
           texture_info->pixel_buffer_config.callback,
-          texture_info->pixel_buffer_config.user_data, this);
+          texture_info->pixel_buffer_config.user_data,
+          texture_info->type == kFlutterDesktopExtendedPixelBufferTexture,
+          this);
     case kFlutterDesktopGpuSurfaceTexture:
       return std::make_unique<ExternalTextureSurfaceVulkan>(
           texture_info->gpu_surface_config.callback,
           texture_info->gpu_surface_config.user_data, this);
+    case kFlutterDesktopPixelBufferPoolTexture:
+      // Created as GPU surface textures by the texture registrar.
+      return nullptr;
   }
   return nullptr;
 }
@@ -555,6 +575,19 @@ bool TizenRendererVulkan::CreateCommandPool() {
   return true;
 }
 
+bool TizenRendererVulkan::CreateTransferCommandPool() {
+  VkCommandPoolCreateInfo pool_info{};
+  pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+  pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+  pool_info.queueFamilyIndex = graphics_queue_family_index_;
+  if (vkCreateCommandPool(logical_device_, &pool_info, nullptr,
+                          &transfer_command_pool_) != VK_SUCCESS) {
+    FT_LOG(Error) << "Failed to create transfer command pool.";
+    return false;
+  }
+  return true;
+}
+
 void TizenRendererVulkan::DestroyCommandPool() {
   if (swapchain_command_pool_) {
     vkDestroyCommandPool(logical_device_, swapchain_command_pool_, nullptr);
@@ -562,29 +595,68 @@ void TizenRendererVulkan::DestroyCommandPool() {
   }
 }
 
-bool TizenRendererVulkan::CreateSemaphore() {
-  VkSemaphoreCreateInfo semaphore_info{};
-  semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-  if (vkCreateSemaphore(logical_device_, &semaphore_info, nullptr,
-                        &present_transition_semaphore_) != VK_SUCCESS) {
-    FT_LOG(Error) << "Failed to create semaphore.";
+bool TizenRendererVulkan::CreateFence(bool signaled, VkFence* fence_out) {
+  VkFenceCreateInfo fence_info{};
+  fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+  if (signaled) {
+    fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+  }
+  if (vkCreateFence(logical_device_, &fence_info, nullptr, fence_out) !=
+      VK_SUCCESS) {
+    FT_LOG(Error) << "Failed to create fence.";
     return false;
   }
   return true;
 }
 
-bool TizenRendererVulkan::CreateFence() {
-  VkFenceCreateInfo fence_info{};
-  fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-  if (vkCreateFence(logical_device_, &fence_info, nullptr,
-                    &image_ready_fence_) != VK_SUCCESS) {
-    FT_LOG(Error) << "Failed to create image ready fence.";
-    return false;
+bool TizenRendererVulkan::CreateFrameSyncObjects() {
+  for (FrameSync& frame : frames_) {
+    // The submit fences start signaled since no work is pending yet.
+    if (!CreateFence(false, &frame.acquire_fence) ||
+        !CreateFence(true, &frame.submit_fence)) {
+      return false;
+    }
   }
+  current_frame_ = 0;
+  return true;
+}
 
+void TizenRendererVulkan::DestroyFrameSyncObjects() {
+  for (FrameSync& frame : frames_) {
+    if (frame.acquire_fence != VK_NULL_HANDLE) {
+      vkDestroyFence(logical_device_, frame.acquire_fence, nullptr);
+      frame.acquire_fence = VK_NULL_HANDLE;
+    }
+    if (frame.submit_fence != VK_NULL_HANDLE) {
+      vkDestroyFence(logical_device_, frame.submit_fence, nullptr);
+      frame.submit_fence = VK_NULL_HANDLE;
+    }
+  }
+}
+
+bool TizenRendererVulkan::CreatePresentSemaphores() {
+  VkSemaphoreCreateInfo semaphore_info{};
+  semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  present_semaphores_.resize(swapchain_images_.size(), VK_NULL_HANDLE);
+  for (VkSemaphore& semaphore : present_semaphores_) {
+    if (vkCreateSemaphore(logical_device_, &semaphore_info, nullptr,
+                          &semaphore) != VK_SUCCESS) {
+      FT_LOG(Error) << "Failed to create semaphore.";
+      return false;
+    }
+  }
   return true;
 }
 
+void TizenRendererVulkan::DestroyPresentSemaphores() {
+  for (VkSemaphore semaphore : present_semaphores_) {
+    if (semaphore != VK_NULL_HANDLE) {
+      vkDestroySemaphore(logical_device_, semaphore, nullptr);
+    }
+  }
+  present_semaphores_.clear();
+}
+
 VkSurfaceFormatKHR TizenRendererVulkan::GetSwapChainFormat(
     std::vector<VkSurfaceFormatKHR>& surface_formats) {
   // If the list contains only one entry with undefined format
@@ -633,23 +705,40 @@ uint32_t TizenRendererVulkan::GetSwapChainNumImages(
   const uint32_t maxImageCount = surface_capabilities.maxImageCount;
   const uint32_t minImageCount = surface_capabilities.minImageCount;
   uint32_t desiredImageCount = minImageCount + 1;
+  switch (presentation_policy_.load()) {
+    case kPresentationLowLatency:
+      desiredImageCount = minImageCount;
+      break;
+    case kPresentationPowerSaving:
+      desiredImageCount = minImageCount + 2;
+      break;
+    case kPresentationBalanced:
+      break;
+  }
 
   // According to section 30.5 of VK 1.1, maxImageCount of zero means "that
   // there is no limit on the number of images, though there may be limits
   // related to the total amount of memory used by presentable images."
   if (maxImageCount != 0 && desiredImageCount > maxImageCount) {
-    desiredImageCount = surface_capabilities.minImageCount;
+    desiredImageCount = maxImageCount;
   }
   return desiredImageCount;
 }
 
 VkPresentModeKHR TizenRendererVulkan::GetSwapChainPresentMode(
     std::vector<VkPresentModeKHR>& present_modes) {
+  VkPresentModeKHR preferred_mode = VK_PRESENT_MODE_FIFO_KHR;
+  if (presentation_policy_.load() == kPresentationLowLatency) {
+    preferred_mode = VK_PRESENT_MODE_MAILBOX_KHR;
+  }
+  // FIFO is always supported, so it is the fallback for MAILBOX.
   VkPresentModeKHR present_mode = present_modes[0];
   for (const auto& mode : present_modes) {
+    if (mode == preferred_mode) {
+      return mode;
+    }
     if (mode == VK_PRESENT_MODE_FIFO_KHR) {
       present_mode = mode;
-      break;
     }
   }
   return present_mode;
@@ -756,6 +845,13 @@ bool TizenRendererVulkan::InitializeSwapchain() {
     return false;
   }
 
+  // A semaphore for each image is only reused once the image has been
+  // acquired again, i.e. after its previous presentation has completed.
+  DestroyPresentSemaphores();
+  if (!CreatePresentSemaphores()) {
+    return false;
+  }
+
   // --------------------------------------------------------------------------
   // Record a command buffer for each of the images to be executed prior to
   // presenting.
@@ -841,6 +937,13 @@ void TizenRendererVulkan::DestroySurface() {
   }
 }
 
+void TizenRendererVulkan::SetPresentationPolicy(
+    FlutterDesktopPresentationPolicy policy) {
+  if (presentation_policy_.exchange(policy) != policy) {
+    presentation_policy_pending_ = true;
+  }
+}
+
 void TizenRendererVulkan::ResizeSurface(int32_t width, int32_t height) {
   if (width_ != width || height_ != height) {
     width_ = width;
@@ -890,13 +993,21 @@ void* TizenRendererVulkan::GetInstanceProcAddress(
 
 FlutterVulkanImage TizenRendererVulkan::GetNextImage(
     const FlutterFrameInfo* frameInfo) {
-  if (resize_pending_) {
+  if (resize_pending_ || presentation_policy_pending_.exchange(false)) {
     RecreateSwapChain();
   }
+  FrameSync& frame = frames_[current_frame_];
+  // Only blocks if the CPU is more than |frames_.size()| frames ahead of the
+  // GPU.
+  vkWaitForFences(logical_device_, 1, &frame.submit_fence, VK_TRUE,
+                  UINT64_MAX);
+  // Frames finish in submission order.
+  DestroyRetiredImages(frame.serial);
+
   VkResult result;
   while (true) {
     result = vkAcquireNextImageKHR(logical_device_, swapchain_, UINT64_MAX,
-                                   VK_NULL_HANDLE, image_ready_fence_,
+                                   VK_NULL_HANDLE, frame.acquire_fence,
                                    &last_image_index_);
     if (result == VK_SUCCESS) {
       // Image successfully acquired.
@@ -923,8 +1034,11 @@ FlutterVulkanImage TizenRendererVulkan::GetNextImage(
     return FlutterVulkanImage{};
   }
 
-  vkWaitForFences(logical_device_, 1, &image_ready_fence_, VK_TRUE, UINT64_MAX);
-  vkResetFences(logical_device_, 1, &image_ready_fence_);
+  // The engine submits its rendering without waiting on a semaphore, so the
+  // image has to be ready before it is returned.
+  vkWaitForFences(logical_device_, 1, &frame.acquire_fence, VK_TRUE,
+                  UINT64_MAX);
+  vkResetFences(logical_device_, 1, &frame.acquire_fence);
   return {
       .struct_size = sizeof(FlutterVulkanImage),
       .image = reinterpret_cast<uint64_t>(swapchain_images_[last_image_index_]),
@@ -933,6 +1047,13 @@ FlutterVulkanImage TizenRendererVulkan::GetNextImage(
 }
 
 bool TizenRendererVulkan::Present(const FlutterVulkanImage* image) {
+  FrameSync& frame = frames_[current_frame_];
+  current_frame_ = (current_frame_ + 1) % frames_.size();
+  VkSemaphore present_semaphore = present_semaphores_[last_image_index_];
+
+  if (frame_stats_) {
+    frame_stats_->OnPresentBegin(FrameStats::Now());
+  }
   VkPipelineStageFlags stage_flags =
       VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
   VkSubmitInfo submit_info{};
@@ -943,24 +1064,35 @@ bool TizenRendererVulkan::Present(const FlutterVulkanImage* image) {
   submit_info.commandBufferCount = 1;
   submit_info.pCommandBuffers = &present_transition_buffers_[last_image_index_];
   submit_info.signalSemaphoreCount = 1;
-  submit_info.pSignalSemaphores = &present_transition_semaphore_;
-  vkQueueSubmit(graphics_queue_, 1, &submit_info, VK_NULL_HANDLE);
+  submit_info.pSignalSemaphores = &present_semaphore;
+  frame.serial = ++last_frame_serial_;
+  vkResetFences(logical_device_, 1, &frame.submit_fence);
+  if (vkQueueSubmit(graphics_queue_, 1, &submit_info, frame.submit_fence) !=
+      VK_SUCCESS) {
+    FT_LOG(Error) << "Failed to submit the present transition.";
+    // Replace the fence that would never be signaled.
+    vkDestroyFence(logical_device_, frame.submit_fence, nullptr);
+    CreateFence(true, &frame.submit_fence);
+    return false;
+  }
 
   VkPresentInfoKHR present_info{};
   present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
   present_info.waitSemaphoreCount = 1;
-  present_info.pWaitSemaphores = &present_transition_semaphore_;
+  present_info.pWaitSemaphores = &present_semaphore;
   present_info.swapchainCount = 1;
   present_info.pSwapchains = &swapchain_;
   present_info.pImageIndices = &last_image_index_;
   VkResult result = vkQueuePresentKHR(graphics_queue_, &present_info);
 
+  if (frame_stats_ && (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)) {
+    frame_stats_->OnPresentEnd(FrameStats::Now());
+  }
   if (result == VK_SUBOPTIMAL_KHR || result == VK_ERROR_OUT_OF_DATE_KHR) {
     return RecreateSwapChain();
-  } else {
-    vkDeviceWaitIdle(logical_device_);
-    return result == VK_SUCCESS;
   }
+  // The next frame is recorded while the GPU is still working on this one.
+  return result == VK_SUCCESS;
 }
 
 size_t TizenRendererVulkan::GetEnabledInstanceExtensionCount() {
@@ -975,18 +1107,23 @@ VkCommandBuffer TizenRendererVulkan::BeginSingleTimeCommands() {
   VkCommandBufferAllocateInfo allocInfo{};
   allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
   allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-  allocInfo.commandPool = swapchain_command_pool_;
+  allocInfo.commandPool = transfer_command_pool_;
   allocInfo.commandBufferCount = 1;
 
+  std::lock_guard<std::mutex> lock(transfer_mutex_);
   VkCommandBuffer commandBuffer;
-  vkAllocateCommandBuffers(logical_device_, &allocInfo, &commandBuffer);
+  if (vkAllocateCommandBuffers(logical_device_, &allocInfo, &commandBuffer) !=
+      VK_SUCCESS) {
+    FT_LOG(Error) << "Failed to allocate one-time command buffer.";
+    return VK_NULL_HANDLE;
+  }
 
   VkCommandBufferBeginInfo beginInfo{};
   beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
   beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
   if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
-    vkFreeCommandBuffers(logical_device_, swapchain_command_pool_, 1,
+    vkFreeCommandBuffers(logical_device_, transfer_command_pool_, 1,
                          &commandBuffer);
     FT_LOG(Error) << "Failed to begin one-time command buffer.";
     return VK_NULL_HANDLE;
@@ -996,29 +1133,102 @@ VkCommandBuffer TizenRendererVulkan::BeginSingleTimeCommands() {
 }
 
 void TizenRendererVulkan::EndSingleTimeCommands(VkCommandBuffer commandBuffer) {
-  if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+  uint64_t serial = SubmitTransfer(commandBuffer);
+  if (serial != 0) {
+    WaitForTransfer(serial);
+  }
+}
+
+uint64_t TizenRendererVulkan::SubmitTransfer(VkCommandBuffer command_buffer) {
+  std::lock_guard<std::mutex> lock(transfer_mutex_);
+  if (vkEndCommandBuffer(command_buffer) != VK_SUCCESS) {
     FT_LOG(Error) << "Failed to end one-time command buffer.";
-    vkFreeCommandBuffers(logical_device_, swapchain_command_pool_, 1,
-                         &commandBuffer);
-    return;
+    vkFreeCommandBuffers(logical_device_, transfer_command_pool_, 1,
+                         &command_buffer);
+    return 0;
   }
 
-  VkSubmitInfo submitInfo{};
-  submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-  submitInfo.commandBufferCount = 1;
-  submitInfo.pCommandBuffers = &commandBuffer;
+  RetireTransfers();
+  VkFence fence = VK_NULL_HANDLE;
+  if (!free_transfer_fences_.empty()) {
+    fence = free_transfer_fences_.back();
+    free_transfer_fences_.pop_back();
+  } else if (!CreateFence(false, &fence)) {
+    vkFreeCommandBuffers(logical_device_, transfer_command_pool_, 1,
+                         &command_buffer);
+    return 0;
+  }
 
-  if (vkQueueSubmit(graphics_queue_, 1, &submitInfo, VK_NULL_HANDLE) !=
-      VK_SUCCESS) {
+  VkSubmitInfo submit_info{};
+  submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+  submit_info.commandBufferCount = 1;
+  submit_info.pCommandBuffers = &command_buffer;
+  if (vkQueueSubmit(graphics_queue_, 1, &submit_info, fence) != VK_SUCCESS) {
     FT_LOG(Error) << "Failed to submit one-time command buffer.";
-    vkFreeCommandBuffers(logical_device_, swapchain_command_pool_, 1,
-                         &commandBuffer);
-    return;
+    vkFreeCommandBuffers(logical_device_, transfer_command_pool_, 1,
+                         &command_buffer);
+    free_transfer_fences_.push_back(fence);
+    return 0;
+  }
+  uint64_t serial = ++last_transfer_serial_;
+  pending_transfers_.push_back({serial, command_buffer, fence});
+  return serial;
+}
+
+bool TizenRendererVulkan::IsTransferComplete(uint64_t serial) {
+  std::lock_guard<std::mutex> lock(transfer_mutex_);
+  RetireTransfers();
+  return serial <= completed_transfer_serial_;
+}
+
+void TizenRendererVulkan::WaitForTransfer(uint64_t serial) {
+  std::lock_guard<std::mutex> lock(transfer_mutex_);
+  for (const PendingTransfer& transfer : pending_transfers_) {
+    if (transfer.serial == serial) {
+      vkWaitForFences(logical_device_, 1, &transfer.fence, VK_TRUE,
+                      UINT64_MAX);
+      break;
+    }
+  }
+  RetireTransfers();
+}
+
+void TizenRendererVulkan::RetireImage(VkImage image, VkDeviceMemory memory) {
+  std::lock_guard<std::mutex> lock(retired_images_mutex_);
+  retired_images_.push_back({last_frame_serial_.load() + 1, image, memory});
+}
+
+void TizenRendererVulkan::DestroyRetiredImages(
+    uint64_t completed_frame_serial) {
+  std::lock_guard<std::mutex> lock(retired_images_mutex_);
+  while (!retired_images_.empty() &&
+         retired_images_.front().frame_serial <= completed_frame_serial) {
+    RetiredImage& retired = retired_images_.front();
+    if (retired.image != VK_NULL_HANDLE) {
+      vkDestroyImage(logical_device_, retired.image, nullptr);
+    }
+    if (retired.memory != VK_NULL_HANDLE) {
+      vkFreeMemory(logical_device_, retired.memory, nullptr);
+    }
+    retired_images_.pop_front();
   }
-  vkQueueWaitIdle(graphics_queue_);
+}
 
-  vkFreeCommandBuffers(logical_device_, swapchain_command_pool_, 1,
-                       &commandBuffer);
+void TizenRendererVulkan::RetireTransfers() {
+  // Submissions are retired in order, so a serial is complete once all
+  // earlier submissions are.
+  while (!pending_transfers_.empty()) {
+    PendingTransfer& transfer = pending_transfers_.front();
+    if (vkGetFenceStatus(logical_device_, transfer.fence) != VK_SUCCESS) {
+      break;
+    }
+    vkFreeCommandBuffers(logical_device_, transfer_command_pool_, 1,
+                         &transfer.command_buffer);
+    vkResetFences(logical_device_, 1, &transfer.fence);
+    free_transfer_fences_.push_back(transfer.fence);
+    completed_transfer_serial_ = transfer.serial;
+    pending_transfers_.pop_front();
+  }
 }
 
 bool TizenRendererVulkan::FindMemoryType(uint32_t type_filter,
@@ -8,20 +8,33 @@
 #if defined(__linux__) || defined(__unix__)
 #define VK_USE_PLATFORM_WAYLAND_KHR
 #endif
+#include "flutter/shell/platform/tizen/public/flutter_tizen.h"
 #include "flutter/shell/platform/tizen/tizen_renderer.h"
 #include "flutter/shell/platform/tizen/tizen_view_base.h"
 #include "flutter/third_party/volk/volk.h"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace flutter {
 
 class TizenRendererVulkan : public TizenRenderer {
  public:
-  explicit TizenRendererVulkan(TizenViewBase* view);
+  static constexpr uint32_t kDefaultFramesInFlight = 2;
+  static constexpr uint32_t kMaxFramesInFlight = 4;
+
+  // |frames_in_flight| is the number of frames that can be recorded ahead of
+  // the GPU, from 1 (no overlap) to kMaxFramesInFlight.
+  explicit TizenRendererVulkan(
+      TizenViewBase* view,
+      uint32_t frames_in_flight = kDefaultFramesInFlight,
+      FlutterDesktopPresentationPolicy presentation_policy =
+          kPresentationBalanced);
   virtual ~TizenRendererVulkan();
 
   std::unique_ptr<ExternalTexture> CreateExternalTexture(
@@ -35,6 +48,11 @@ class TizenRendererVulkan : public TizenRenderer {
                      int32_t height) override;
   void DestroySurface() override;
   void ResizeSurface(int32_t width, int32_t height) override;
+
+  // Changes the present mode and the number of swapchain images. The
+  // swapchain is recreated before the next frame. Can be called on any
+  // thread.
+  void SetPresentationPolicy(FlutterDesktopPresentationPolicy policy);
   uint32_t GetVersion();
   FlutterVulkanInstanceHandle GetInstanceHandle();
   FlutterVulkanQueueHandle GetQueueHandle();
@@ -51,16 +69,48 @@ class TizenRendererVulkan : public TizenRenderer {
   bool Present(const FlutterVulkanImage* image);
   VkCommandBuffer BeginSingleTimeCommands();
   void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
+
+  // Ends and submits |command_buffer| from BeginSingleTimeCommands() without
+  // waiting for it to execute. Returns a serial that identifies the
+  // submission, or 0 on failure.
+  //
+  // Commands submitted later to the same queue, such as the engine's
+  // rendering, are ordered after the submission by any pipeline barriers it
+  // ends with.
+  uint64_t SubmitTransfer(VkCommandBuffer command_buffer);
+
+  // Returns whether the submission |serial| has finished executing.
+  bool IsTransferComplete(uint64_t serial);
+
+  // Blocks until the submission |serial| has finished executing. Unlike
+  // vkQueueWaitIdle(), this does not wait for unrelated work on the queue.
+  void WaitForTransfer(uint64_t serial);
+
+  // Destroys |image| and frees |memory| once the frames that may have
+  // sampled the image, including the frame being recorded, have finished
+  // executing. Can be called on any thread.
+  void RetireImage(VkImage image, VkDeviceMemory memory);
+
   bool FindMemoryType(uint32_t type_filter,
                       VkMemoryPropertyFlags properties,
                       uint32_t* index_out);
 
  private:
   bool CreateCommandPool();
+  bool CreateTransferCommandPool();
+  // Frees the resources of submissions that have finished executing. Called
+  // with |transfer_mutex_| held.
+  void RetireTransfers();
+  // Destroys the retired images whose frames are no later than
+  // |completed_frame_serial|.
+  void DestroyRetiredImages(uint64_t completed_frame_serial);
   bool CreateInstance();
   bool CreateLogicalDevice();
-  bool CreateFence();
-  bool CreateSemaphore();
+  bool CreateFence(bool signaled, VkFence* fence_out);
+  bool CreateFrameSyncObjects();
+  void DestroyFrameSyncObjects();
+  bool CreatePresentSemaphores();
+  void DestroyPresentSemaphores();
   void Cleanup();
   bool CheckValidationLayerSupport();
   void DestroyCommandPool();
@@ -92,17 +142,59 @@ class TizenRendererVulkan : public TizenRenderer {
   VkQueue graphics_queue_ = VK_NULL_HANDLE;
   VkSurfaceKHR surface_ = VK_NULL_HANDLE;
   VkSurfaceFormatKHR surface_format_;
-  VkSemaphore present_transition_semaphore_ = VK_NULL_HANDLE;
-  VkFence image_ready_fence_ = VK_NULL_HANDLE;
   VkSwapchainKHR swapchain_ = VK_NULL_HANDLE;
   VkCommandPool swapchain_command_pool_ = VK_NULL_HANDLE;
   std::vector<VkImage> swapchain_images_;
   std::vector<VkCommandBuffer> present_transition_buffers_;
+  // Signaled when the transition of a swapchain image for presentation has
+  // finished. Indexed by swapchain image.
+  std::vector<VkSemaphore> present_semaphores_;
+
+  struct FrameSync {
+    // Signaled when the acquired image can be rendered into.
+    VkFence acquire_fence = VK_NULL_HANDLE;
+    // Signaled when the GPU has finished the work submitted for the frame.
+    VkFence submit_fence = VK_NULL_HANDLE;
+    // The serial of the frame that |submit_fence| was last submitted with.
+    uint64_t serial = 0;
+  };
+  // A ring of frames that may be in flight at the same time.
+  std::vector<FrameSync> frames_;
+  size_t current_frame_ = 0;
   std::vector<const char*> enabled_device_extensions_;
   std::vector<const char*> enabled_instance_extensions_;
   uint32_t graphics_queue_family_index_ = 0;
+
+  struct PendingTransfer {
+    uint64_t serial;
+    VkCommandBuffer command_buffer;
+    VkFence fence;
+  };
+  // Single-time commands are allocated from a pool of their own that is not
+  // reset when the swapchain is recreated.
+  VkCommandPool transfer_command_pool_ = VK_NULL_HANDLE;
+  // Submissions in submission order.
+  std::deque<PendingTransfer> pending_transfers_;
+  std::vector<VkFence> free_transfer_fences_;
+  uint64_t last_transfer_serial_ = 0;
+  uint64_t completed_transfer_serial_ = 0;
+  std::mutex transfer_mutex_;
+
+  struct RetiredImage {
+    // The last frame that may sample the image.
+    uint64_t frame_serial;
+    VkImage image;
+    VkDeviceMemory memory;
+  };
+  // Images waiting for their frames to finish, in retirement order.
+  std::deque<RetiredImage> retired_images_;
+  std::mutex retired_images_mutex_;
+  // The serial of the last frame submitted by Present().
+  std::atomic<uint64_t> last_frame_serial_ = 0;
   uint32_t last_image_index_ = 0;
   bool resize_pending_ = false;
+  std::atomic<FlutterDesktopPresentationPolicy> presentation_policy_;
+  std::atomic<bool> presentation_policy_pending_ = false;
   int32_t width_ = 0;
   int32_t height_ = 0;
 };
@@ -3,35 +3,222 @@
 // found in the LICENSE file.
 
 #include "tizen_vsync_waiter.h"
-#include "flutter/shell/platform/tizen/flutter_tizen_engine.h"
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <utility>
+
 #include "flutter/shell/platform/tizen/logger.h"
 
 namespace flutter {
 
-TizenVsyncWaiter::TizenVsyncWaiter(FlutterTizenEngine* engine)
-    : tdm_client_(std::make_shared<TdmClient>(engine)),
-      message_loop_(std::make_unique<MessageLoop>()) {}
+TizenVsyncWaiter::TizenVsyncWaiter(VsyncCallback callback,
+                                   std::unique_ptr<TdmClient> tdm_client)
+    : callback_(std::move(callback)), tdm_client_(std::move(tdm_client)) {
+  wakeup_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wakeup_fd_ < 0) {
+    FT_LOG(Error) << "Failed to create an eventfd: " << strerror(errno);
+    FallBackToTimer();
+    return;
+  }
+  vsync_thread_ = std::thread(&TizenVsyncWaiter::Run, this);
+}
 
 TizenVsyncWaiter::~TizenVsyncWaiter() {
-  tdm_client_->OnEngineStop();
+  quit_ = true;
+  if (wakeup_fd_ >= 0) {
+    uint64_t value = 1;
+    write(wakeup_fd_, &value, sizeof(value));
+  }
+  if (vsync_thread_.joinable()) {
+    vsync_thread_.join();
+  }
+  if (wakeup_fd_ >= 0) {
+    close(wakeup_fd_);
+  }
+  fallback_.reset();
 }
 
 void TizenVsyncWaiter::AsyncWaitForVsync(intptr_t baton) {
-  std::weak_ptr<TdmClient> tdm_client = tdm_client_;
-  message_loop_->PostTask([tdm_client_weak = std::move(tdm_client), baton]() {
-    if (auto tdm_client = tdm_client_weak.lock()) {
-      if (tdm_client->IsValid()) {
-        tdm_client->AwaitVblank(baton);
-      } else {
-        FT_LOG(Error) << "tdm client is invalid, task cancelled";
+  // Decide once under the lock. |FallBackToTimer| may flip |use_fallback_|
+  // after the lock is released, in which case it forwards the pending baton
+  // itself and it must not be forwarded again here.
+  bool forward = false;
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    forward = use_fallback_;
+    if (!forward) {
+      pending_batons_.push_back(baton);
+    }
+  }
+  if (forward) {
+    fallback_->AsyncWaitForVsync(baton);
+    return;
+  }
+  uint64_t value = 1;
+  if (write(wakeup_fd_, &value, sizeof(value)) < 0) {
+    FT_LOG(Error) << "Failed to wake up the vsync thread: " << strerror(errno);
+  }
+}
+
+void TizenVsyncWaiter::Run() {
+  if (!tdm_client_) {
+    tdm_client_ = std::make_unique<TdmClient>();
+  }
+
+  int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd < 0) {
+    FT_LOG(Error) << "Failed to create an epoll instance: " << strerror(errno);
+    tdm_client_.reset();
+    FallBackToTimer();
+    return;
+  }
+
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = wakeup_fd_;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd_, &event);
+
+  int tdm_fd = tdm_client_->IsValid() ? tdm_client_->GetFd() : -1;
+  bool tdm_failed = tdm_fd < 0;
+  if (!tdm_failed) {
+    event.data.fd = tdm_fd;
+    tdm_failed = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, tdm_fd, &event) < 0;
+  }
+
+  while (!quit_ && !tdm_failed) {
+    epoll_event events[2];
+    int count = epoll_wait(epoll_fd, events, 2, -1);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
       }
-    } else {
-      FT_LOG(Error) << "tdm client is null, task cancelled";
+      FT_LOG(Error) << "epoll_wait failed: " << strerror(errno);
+      tdm_failed = true;
+      break;
+    }
+
+    for (int i = 0; i < count; i++) {
+      if (events[i].data.fd == wakeup_fd_) {
+        uint64_t value;
+        read(wakeup_fd_, &value, sizeof(value));
+      } else if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+        FT_LOG(Error) << "The TDM client fd was closed or has an error.";
+        tdm_failed = true;
+      } else if (!tdm_client_->HandleEvents() || vblank_failed_) {
+        tdm_failed = true;
+      }
+    }
+    if (quit_ || tdm_failed) {
+      break;
     }
-  });
+    tdm_failed = !RequestVblankIfNeeded();
+  }
+
+  close(epoll_fd);
+  tdm_client_.reset();
+  if (!quit_ && tdm_failed) {
+    FallBackToTimer();
+  }
+}
+
+bool TizenVsyncWaiter::RequestVblankIfNeeded() {
+  if (vblank_requested_) {
+    return true;
+  }
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    if (pending_batons_.empty()) {
+      return true;
+    }
+  }
+  // Set before waiting in case the callback is invoked synchronously.
+  vblank_requested_ = true;
+  if (!tdm_client_->WaitVblank(VblankCallback, this)) {
+    vblank_requested_ = false;
+    return false;
+  }
+  return !vblank_failed_;
 }
 
-TdmClient::TdmClient(FlutterTizenEngine* engine) {
+void TizenVsyncWaiter::NotifyVsync(uint64_t frame_start_time_nanos) {
+  std::deque<intptr_t> batons;
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    batons.swap(pending_batons_);
+  }
+  uint64_t frame_target_time_nanos =
+      frame_start_time_nanos + vsync_period_nanos_.load();
+  for (intptr_t baton : batons) {
+    callback_(baton, frame_start_time_nanos, frame_target_time_nanos);
+  }
+}
+
+void TizenVsyncWaiter::FallBackToTimer() {
+  FT_LOG(Error) << "TDM vsync is unavailable, falling back to a timer.";
+  vblank_requested_ = false;
+
+  uint64_t period_nanos = vsync_period_nanos_.load();
+  auto fallback = std::make_unique<TimerVsyncWaiter>(callback_, period_nanos);
+  fallback->SetPeriodChangedCallback(
+      [this](uint64_t period_nanos) { ReportPeriod(period_nanos); });
+  uint64_t last_vsync_nanos = last_vsync_nanos_.load();
+  if (last_vsync_nanos != 0) {
+    fallback->SetPhase(last_vsync_nanos, period_nanos);
+  }
+
+  std::deque<intptr_t> batons;
+  {
+    std::lock_guard<std::mutex> lock(pending_batons_mutex_);
+    fallback_ = std::move(fallback);
+    use_fallback_ = true;
+    batons.swap(pending_batons_);
+  }
+  for (intptr_t baton : batons) {
+    fallback_->AsyncWaitForVsync(baton);
+  }
+}
+
+void TizenVsyncWaiter::VblankCallback(tdm_client_vblank* vblank,
+                                      tdm_error error,
+                                      unsigned int sequence,
+                                      unsigned int tv_sec,
+                                      unsigned int tv_usec,
+                                      void* user_data) {
+  auto* self = static_cast<TizenVsyncWaiter*>(user_data);
+  FT_ASSERT(self != nullptr);
+
+  self->vblank_requested_ = false;
+  if (error != TDM_ERROR_NONE) {
+    FT_LOG(Error) << "vblank wait failed with error: " << error;
+    // The batons are handed over to the fallback timer by |Run|.
+    self->vblank_failed_ = true;
+    return;
+  }
+
+  uint64_t frame_start_time_nanos =
+      static_cast<uint64_t>(tv_sec) * 1000000000 +
+      static_cast<uint64_t>(tv_usec) * 1000;
+  self->period_estimator_.AddVblank(sequence, frame_start_time_nanos);
+  self->vsync_period_nanos_.store(self->period_estimator_.period_nanos());
+  self->last_vsync_nanos_.store(frame_start_time_nanos);
+  if (self->period_estimator_.has_estimate()) {
+    self->ReportPeriod(self->period_estimator_.period_nanos());
+  }
+  self->NotifyVsync(frame_start_time_nanos);
+}
+
+TdmClient::TdmClient(bool connect) {
+  if (!connect) {
+    return;
+  }
   tdm_error ret;
   client_ = tdm_client_create(&ret);
   if (ret != TDM_ERROR_NONE) {
@@ -51,7 +238,6 @@ TdmClient::TdmClient(FlutterTizenEngine* engine) {
     return;
   }
   tdm_client_vblank_set_enable_fake(vblank_, 1);
-  engine_ = engine;
 }
 
 TdmClient::~TdmClient() {
@@ -70,37 +256,85 @@ bool TdmClient::IsValid() {
   return vblank_ && client_;
 }
 
-void TdmClient::OnEngineStop() {
-  std::lock_guard<std::mutex> lock(engine_mutex_);
-  engine_ = nullptr;
+int TdmClient::GetFd() {
+  if (!client_) {
+    return -1;
+  }
+  int fd = -1;
+  if (tdm_client_get_fd(client_, &fd) != TDM_ERROR_NONE) {
+    FT_LOG(Error) << "Could not get the TDM client fd.";
+    return -1;
+  }
+  return fd;
 }
 
-void TdmClient::AwaitVblank(intptr_t baton) {
-  baton_ = baton;
-  tdm_error ret = tdm_client_vblank_wait(vblank_, 1, VblankCallback, this);
+bool TdmClient::WaitVblank(tdm_client_vblank_handler handler,
+                           void* user_data) {
+  tdm_error ret = tdm_client_vblank_wait(vblank_, 1, handler, user_data);
   if (ret != TDM_ERROR_NONE) {
     FT_LOG(Error) << "tdm_client_vblank_wait failed with error: " << ret;
-    return;
+    return false;
   }
-  tdm_client_handle_events(client_);
+  return true;
 }
 
-void TdmClient::VblankCallback(tdm_client_vblank* vblank,
-                               tdm_error error,
-                               unsigned int sequence,
-                               unsigned int tv_sec,
-                               unsigned int tv_usec,
-                               void* user_data) {
-  auto* self = static_cast<TdmClient*>(user_data);
-  FT_ASSERT(self != nullptr);
+bool TdmClient::WaitForVblankTimestamp(int timeout_ms,
+                                       uint64_t* vblank_nanos) {
+  if (!IsValid()) {
+    return false;
+  }
+  int fd = GetFd();
+  if (fd < 0) {
+    return false;
+  }
+  struct Result {
+    bool received = false;
+    uint64_t vblank_nanos = 0;
+  } result;
+  auto handler = [](tdm_client_vblank* vblank, tdm_error error,
+                    unsigned int sequence, unsigned int tv_sec,
+                    unsigned int tv_usec, void* user_data) {
+    auto* result = static_cast<Result*>(user_data);
+    if (error == TDM_ERROR_NONE) {
+      result->received = true;
+      result->vblank_nanos = static_cast<uint64_t>(tv_sec) * 1000000000 +
+                             static_cast<uint64_t>(tv_usec) * 1000;
+    }
+  };
+  if (!WaitVblank(handler, &result)) {
+    return false;
+  }
 
-  std::lock_guard<std::mutex> lock(self->engine_mutex_);
-  if (self->engine_) {
-    uint64_t frame_start_time_nanos = tv_sec * 1e9 + tv_usec * 1e3;
-    uint64_t frame_target_time_nanos = frame_start_time_nanos + 16.6 * 1e6;
-    self->engine_->OnVsync(self->baton_, frame_start_time_nanos,
-                           frame_target_time_nanos);
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(timeout_ms);
+  while (!result.received) {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) {
+      FT_LOG(Error) << "Timed out waiting for a vblank.";
+      return false;
+    }
+    pollfd poll_fd = {fd, POLLIN, 0};
+    int count = poll(&poll_fd, 1, static_cast<int>(remaining.count()));
+    if (count < 0 && errno != EINTR) {
+      FT_LOG(Error) << "poll failed: " << strerror(errno);
+      return false;
+    }
+    if (count > 0 && !HandleEvents()) {
+      return false;
+    }
+  }
+  *vblank_nanos = result.vblank_nanos;
+  return true;
+}
+
+bool TdmClient::HandleEvents() {
+  tdm_error ret = tdm_client_handle_events(client_);
+  if (ret != TDM_ERROR_NONE) {
+    FT_LOG(Error) << "tdm_client_handle_events failed with error: " << ret;
+    return false;
   }
+  return true;
 }
 
 }  // namespace flutter
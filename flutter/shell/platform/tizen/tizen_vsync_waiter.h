@@ -8,119 +8,133 @@
 #include <tdm_client.h>
 
 #include <atomic>
-#include <condition_variable>
-#include <functional>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 
 #include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/tizen/timer_vsync_waiter.h"
+#include "flutter/shell/platform/tizen/vsync_period_estimator.h"
+#include "flutter/shell/platform/tizen/vsync_waiter.h"
 
 namespace flutter {
 
-class FlutterTizenEngine;
-
 class TdmClient {
  public:
-  TdmClient(FlutterTizenEngine* engine);
+  TdmClient() : TdmClient(true) {}
   virtual ~TdmClient();
 
-  bool IsValid();
-  void OnEngineStop();
-  void AwaitVblank(intptr_t baton);
+  virtual bool IsValid();
 
- private:
-  static void VblankCallback(tdm_client_vblank* vblank,
-                             tdm_error error,
-                             unsigned int sequence,
-                             unsigned int tv_sec,
-                             unsigned int tv_usec,
-                             void* user_data);
+  // Returns the file descriptor that becomes readable when TDM events are
+  // pending, or -1 on failure.
+  virtual int GetFd();
 
-  FlutterTizenEngine* engine_ = nullptr;
-  std::mutex engine_mutex_;
+  // Requests |handler| to be called on the next vblank.
+  virtual bool WaitVblank(tdm_client_vblank_handler handler, void* user_data);
 
+  // Dispatches pending TDM events. Returns false if the connection to the
+  // TDM server is broken.
+  virtual bool HandleEvents();
+
+  // Waits up to |timeout_ms| for the next vblank and stores its timestamp in
+  // |vblank_nanos|. Returns false on failure or timeout, after which the
+  // client must not be used to handle events anymore.
+  bool WaitForVblankTimestamp(int timeout_ms, uint64_t* vblank_nanos);
+
+ protected:
+  // Does not connect to TDM if |connect| is false. Used by fakes in tests.
+  explicit TdmClient(bool connect);
+
+ private:
   tdm_client* client_ = nullptr;
   tdm_client_output* output_ = nullptr;
   tdm_client_vblank* vblank_ = nullptr;
-
-  intptr_t baton_ = 0;
 };
 
-class TizenVsyncWaiter {
+// Delivers vsync signals to the engine from a dedicated thread.
+//
+// The thread owns the TDM client and waits on its file descriptor with
+// epoll, so no task has to be posted per frame. The refresh period reported
+// to the engine is measured from the vblank timestamps rather than assumed.
+//
+// If TDM is unavailable or fails at runtime, vsync is delivered by a
+// TimerVsyncWaiter instead so that the engine never stalls.
+class TizenVsyncWaiter : public VsyncWaiter {
  public:
-  TizenVsyncWaiter(FlutterTizenEngine* engine);
+  // Vblank events are received from |tdm_client| if given, or from a new
+  // client connected on the vsync thread otherwise.
+  explicit TizenVsyncWaiter(VsyncCallback callback,
+                            std::unique_ptr<TdmClient> tdm_client = nullptr);
   virtual ~TizenVsyncWaiter();
-  void AsyncWaitForVsync(intptr_t baton);
 
- private:
-  class MessageLoop {
-   public:
-    using Task = std::function<void()>;
+  void AsyncWaitForVsync(intptr_t baton) override;
 
-    MessageLoop() : quit_(false) {
-      loop_thread_ = std::thread(&MessageLoop::Run, this);
+  // Returns the measured refresh period of the display.
+  uint64_t GetVsyncPeriodNanos() const override {
+    if (use_fallback_) {
+      return fallback_->GetVsyncPeriodNanos();
     }
+    return vsync_period_nanos_.load();
+  }
 
-    ~MessageLoop() { Quit(); }
-
-    void PostTask(Task task) {
-      {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (quit_) {
-          return;
-        }
-        tasks_.push(std::move(task));
-      }
-      cond_.notify_one();
+  uint64_t GetLastVsyncNanos() const override {
+    if (use_fallback_) {
+      return fallback_->GetLastVsyncNanos();
     }
+    return last_vsync_nanos_.load();
+  }
 
-    void Quit() {
-      {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (quit_) {
-          return;
-        }
-        quit_ = true;
-      }
-      cond_.notify_all();
-
-      if (loop_thread_.joinable()) {
-        loop_thread_.join();
-      }
-    }
+ private:
+  // The body of |vsync_thread_|.
+  void Run();
 
-   private:
-    void Run() {
-      while (true) {
-        Task task;
-        {
-          std::unique_lock<std::mutex> lock(mutex_);
-          cond_.wait(lock, [this] { return !tasks_.empty() || quit_; });
-          if (quit_) {
-            break;
-          }
-
-          task = std::move(tasks_.front());
-          tasks_.pop();
-        }
-
-        if (task) {
-          task();
-        }
-      }
-    }
+  // Issues a vblank request if a baton is pending and none is in flight.
+  // Returns false if TDM failed.
+  bool RequestVblankIfNeeded();
+
+  // Reports a vsync to the engine for every pending baton.
+  void NotifyVsync(uint64_t frame_start_time_nanos);
+
+  // Hands the pending and all future batons over to |fallback_|, which
+  // ticks in phase with the last vblank received from TDM.
+  void FallBackToTimer();
+
+  static void VblankCallback(tdm_client_vblank* vblank,
+                             tdm_error error,
+                             unsigned int sequence,
+                             unsigned int tv_sec,
+                             unsigned int tv_usec,
+                             void* user_data);
+
+  VsyncCallback callback_;
+
+  // Only accessed on |vsync_thread_|.
+  std::unique_ptr<TdmClient> tdm_client_;
+  VsyncPeriodEstimator period_estimator_;
+  bool vblank_requested_ = false;
+  // Set by |VblankCallback| if TDM reported an error.
+  bool vblank_failed_ = false;
+
+  // Batons waiting for the next vblank.
+  std::deque<intptr_t> pending_batons_;
+  std::mutex pending_batons_mutex_;
+
+  // Delivers vsync once TDM has failed. Set before |use_fallback_| and never
+  // reset until destruction.
+  std::unique_ptr<TimerVsyncWaiter> fallback_;
+  std::atomic<bool> use_fallback_ = false;
 
-    std::queue<Task> tasks_;
-    std::mutex mutex_;
-    std::condition_variable cond_;
-    std::atomic<bool> quit_;
-    std::thread loop_thread_;
-  };
+  std::atomic<uint64_t> vsync_period_nanos_ =
+      VsyncPeriodEstimator::kDefaultPeriodNanos;
+  std::atomic<uint64_t> last_vsync_nanos_ = 0;
 
-  std::shared_ptr<TdmClient> tdm_client_;
-  std::unique_ptr<MessageLoop> message_loop_;
+  // An eventfd used to wake up |vsync_thread_|.
+  int wakeup_fd_ = -1;
+  std::atomic<bool> quit_ = false;
+  std::thread vsync_thread_;
 };
 
 }  // namespace flutter
@@ -0,0 +1,175 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/tizen_vsync_waiter.h"
+
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr uint64_t kPeriod = 10000000;
+
+uint64_t NowNanos() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+// Delivers a vblank every |kPeriod|, starting shortly before the time of
+// creation, as soon as one is requested.
+class FakeTdmClient : public TdmClient {
+ public:
+  FakeTdmClient() : TdmClient(false) {
+    fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    // TDM reports timestamps in microseconds.
+    next_vblank_nanos_ = (NowNanos() - 10 * kPeriod) / 1000 * 1000;
+  }
+
+  ~FakeTdmClient() { close(fd_); }
+
+  bool IsValid() override { return true; }
+
+  int GetFd() override { return fd_; }
+
+  bool WaitVblank(tdm_client_vblank_handler handler,
+                  void* user_data) override {
+    if (fail_wait_) {
+      return false;
+    }
+    handler_ = handler;
+    user_data_ = user_data;
+    uint64_t value = 1;
+    return write(fd_, &value, sizeof(value)) > 0;
+  }
+
+  bool HandleEvents() override {
+    uint64_t value;
+    if (read(fd_, &value, sizeof(value)) > 0 && handler_) {
+      uint64_t vblank_nanos = next_vblank_nanos_;
+      next_vblank_nanos_ += kPeriod;
+      handler_(nullptr, TDM_ERROR_NONE, sequence_++,
+               vblank_nanos / 1000000000, vblank_nanos % 1000000000 / 1000,
+               user_data_);
+    }
+    return true;
+  }
+
+  // Makes all further vblank requests fail.
+  void FailWaits() { fail_wait_ = true; }
+
+ private:
+  int fd_ = -1;
+  tdm_client_vblank_handler handler_ = nullptr;
+  void* user_data_ = nullptr;
+  unsigned int sequence_ = 1;
+  uint64_t next_vblank_nanos_ = 0;
+  std::atomic<bool> fail_wait_ = false;
+};
+
+// Records the frame start time of every vsync by baton.
+class VsyncRecorder {
+ public:
+  VsyncCallback callback() {
+    return [this](intptr_t baton, uint64_t frame_start_time_nanos,
+                  uint64_t frame_target_time_nanos) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      start_times_[baton] = frame_start_time_nanos;
+      cv_.notify_all();
+    };
+  }
+
+  // Returns the frame start time of |baton|, or 0 on timeout.
+  uint64_t Wait(intptr_t baton) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, std::chrono::seconds(1),
+                 [this, baton] { return start_times_.count(baton) > 0; });
+    return start_times_.count(baton) > 0 ? start_times_[baton] : 0;
+  }
+
+ private:
+  std::map<intptr_t, uint64_t> start_times_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+}  // namespace
+
+TEST(TdmClientTest, WaitsForVblankTimestamp) {
+  FakeTdmClient tdm_client;
+  uint64_t before = NowNanos();
+
+  uint64_t first = 0;
+  ASSERT_TRUE(tdm_client.WaitForVblankTimestamp(100, &first));
+  EXPECT_LT(first, before);
+  uint64_t second = 0;
+  ASSERT_TRUE(tdm_client.WaitForVblankTimestamp(100, &second));
+  EXPECT_EQ(second, first + kPeriod);
+
+  tdm_client.FailWaits();
+  EXPECT_FALSE(tdm_client.WaitForVblankTimestamp(100, &second));
+}
+
+TEST(TizenVsyncWaiterTest, MeasuresPeriodFromVblanks) {
+  VsyncRecorder recorder;
+  auto tdm_client = std::make_unique<FakeTdmClient>();
+  TizenVsyncWaiter waiter(recorder.callback(), std::move(tdm_client));
+
+  uint64_t first = 0;
+  for (intptr_t baton = 1; baton <= 3; baton++) {
+    waiter.AsyncWaitForVsync(baton);
+    uint64_t start = recorder.Wait(baton);
+    ASSERT_NE(start, 0u);
+    if (first == 0) {
+      first = start;
+    }
+    EXPECT_EQ(start, first + (baton - 1) * kPeriod);
+  }
+  EXPECT_EQ(waiter.GetVsyncPeriodNanos(), kPeriod);
+}
+
+TEST(TizenVsyncWaiterTest, FallbackTimerIsInPhaseWithLastVblank) {
+  VsyncRecorder recorder;
+  auto tdm_client = std::make_unique<FakeTdmClient>();
+  FakeTdmClient* fake = tdm_client.get();
+  TizenVsyncWaiter waiter(recorder.callback(), std::move(tdm_client));
+
+  uint64_t last_vblank = 0;
+  for (intptr_t baton = 1; baton <= 3; baton++) {
+    waiter.AsyncWaitForVsync(baton);
+    last_vblank = recorder.Wait(baton);
+    ASSERT_NE(last_vblank, 0u);
+  }
+
+  fake->FailWaits();
+  waiter.AsyncWaitForVsync(4);
+  uint64_t start = recorder.Wait(4);
+  ASSERT_GT(start, last_vblank);
+  EXPECT_EQ((start - last_vblank) % kPeriod, 0u);
+  EXPECT_EQ(waiter.GetVsyncPeriodNanos(), kPeriod);
+  EXPECT_EQ(waiter.GetLastVsyncNanos(), start);
+
+  // Later batons are delivered by the fallback as well.
+  waiter.AsyncWaitForVsync(5);
+  uint64_t next = recorder.Wait(5);
+  ASSERT_GT(next, start);
+  EXPECT_EQ((next - last_vblank) % kPeriod, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
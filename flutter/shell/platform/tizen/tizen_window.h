@@ -21,6 +21,13 @@ class TizenWindow : public TizenViewBase {
 
   virtual int32_t GetRotation() = 0;
 
+  // Tells the compositor that the window contents are rendered unrotated and
+  // have to be rotated by |degree| when displayed, so that the rotation can
+  // be done by the display hardware. The window buffer is resized to the
+  // rotated dimensions. Returns false if the compositor cannot rotate the
+  // contents of the window, in which case the transform is reset to 0.
+  virtual bool SetBufferTransform(int32_t degree) = 0;
+
   virtual void SetPreferredOrientations(const std::vector<int>& rotations) = 0;
 
   virtual void* GetRenderTargetDisplay() = 0;
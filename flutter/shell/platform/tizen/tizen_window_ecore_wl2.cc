@@ -11,6 +11,7 @@
 #include <time.h>
 #include <vconf.h>
 #include <sstream>
+#include <utility>
 #endif
 
 #include "flutter/shell/platform/embedder/embedder.h"
@@ -418,9 +419,11 @@ void TizenWindowEcoreWl2::RegisterEventHandlers() {
               reinterpret_cast<Ecore_Wl2_Event_Window_Rotation*>(event);
           if (rotation_event->win == self->GetWindowId()) {
             int32_t degree = rotation_event->angle;
+            // Set first so that the EGL window is resized with the new
+            // rotation if the view changes the buffer transform.
+            ecore_wl2_window_rotation_set(self->ecore_wl2_window_, degree);
             self->view_delegate_->OnRotate(degree);
             TizenGeometry geometry = self->GetGeometry();
-            ecore_wl2_window_rotation_set(self->ecore_wl2_window_, degree);
             ecore_wl2_window_rotation_change_done_send(
                 self->ecore_wl2_window_, rotation_event->rotation,
                 geometry.width, geometry.height);
@@ -439,10 +442,8 @@ void TizenWindowEcoreWl2::RegisterEventHandlers() {
             auto* configure_event =
                 reinterpret_cast<Ecore_Wl2_Event_Window_Configure*>(event);
             if (configure_event->win == self->GetWindowId()) {
-              ecore_wl2_egl_window_resize_with_rotation(
-                  self->ecore_wl2_egl_window_, configure_event->x,
-                  configure_event->y, configure_event->w, configure_event->h,
-                  self->GetRotation());
+              self->ResizeEglWindow(configure_event->x, configure_event->y,
+                                    configure_event->w, configure_event->h);
 
               self->view_delegate_->OnResize(
                   configure_event->x, configure_event->y, configure_event->w,
@@ -663,6 +664,46 @@ int32_t TizenWindowEcoreWl2::GetRotation() {
   return ecore_wl2_window_rotation_get(ecore_wl2_window_);
 }
 
+bool TizenWindowEcoreWl2::SetBufferTransform(int32_t degree) {
+  if (!ecore_wl2_egl_window_) {
+    return false;
+  }
+  degree = (degree % 360 + 360) % 360;
+  bool supported =
+      degree == 0 ||
+      (degree % 90 == 0 &&
+       ecore_wl2_egl_window_capability_get(ecore_wl2_egl_window_) ==
+           ECORE_WL2_EGL_WINDOW_CAPABILITY_ROTATION_SUPPORTED);
+  if (!supported) {
+    degree = 0;
+  }
+  if (degree != buffer_transform_degree_) {
+    // The values of wl_output_transform for 0, 90, 180 and 270 degrees.
+    int transform = degree / 90;
+    ecore_wl2_egl_window_buffer_transform_set(ecore_wl2_egl_window_,
+                                              transform);
+    ecore_wl2_egl_window_window_transform_set(ecore_wl2_egl_window_,
+                                              transform);
+    buffer_transform_degree_ = degree;
+
+    TizenGeometry geometry = GetGeometry();
+    ResizeEglWindow(geometry.left, geometry.top, geometry.width,
+                    geometry.height);
+  }
+  return supported;
+}
+
+void TizenWindowEcoreWl2::ResizeEglWindow(int32_t x,
+                                          int32_t y,
+                                          int32_t width,
+                                          int32_t height) {
+  if (buffer_transform_degree_ == 90 || buffer_transform_degree_ == 270) {
+    std::swap(width, height);
+  }
+  ecore_wl2_egl_window_resize_with_rotation(ecore_wl2_egl_window_, x, y, width,
+                                            height, GetRotation());
+}
+
 int32_t TizenWindowEcoreWl2::GetDpi() {
   Ecore_Wl2_Output* output = ecore_wl2_window_output_find(ecore_wl2_window_);
   if (!output) {
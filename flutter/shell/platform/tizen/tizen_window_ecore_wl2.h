@@ -44,6 +44,8 @@ class TizenWindowEcoreWl2 : public TizenWindow {
 
   int32_t GetRotation() override;
 
+  bool SetBufferTransform(int32_t degree) override;
+
   int32_t GetDpi() override;
 
   uintptr_t GetWindowId() override;
@@ -89,6 +91,10 @@ class TizenWindowEcoreWl2 : public TizenWindow {
 
   void PrepareInputMethod();
 
+  // Resizes the EGL window to |width| x |height|, swapped if the buffer is
+  // rendered rotated by 90 or 270 degrees for the compositor.
+  void ResizeEglWindow(int32_t x, int32_t y, int32_t width, int32_t height);
+
   Ecore_Wl2_Display* ecore_wl2_display_ = nullptr;
   Ecore_Wl2_Window* ecore_wl2_window_ = nullptr;
   Ecore_Wl2_Egl_Window* ecore_wl2_egl_window_ = nullptr;
@@ -97,6 +103,8 @@ class TizenWindowEcoreWl2 : public TizenWindow {
   std::vector<Ecore_Event_Handler*> ecore_event_handlers_;
   tizen_policy* tizen_policy_ = nullptr;
   uint32_t resource_id_ = 0;
+  // The rotation set by SetBufferTransform().
+  int32_t buffer_transform_degree_ = 0;
 
 #ifdef TV_PROFILE
   bool pointing_device_support_ = true;
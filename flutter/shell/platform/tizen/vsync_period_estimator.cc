@@ -0,0 +1,79 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/vsync_period_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter {
+
+namespace {
+
+// Intervals outside this range (250Hz to 20Hz) are ignored as bogus.
+constexpr double kMinPeriodNanos = 4e6;
+constexpr double kMaxPeriodNanos = 50e6;
+
+// The weight of a new sample in the running average.
+constexpr double kSmoothingFactor = 0.125;
+
+// The relative deviation beyond which a sample counts as an outlier.
+constexpr double kOutlierThreshold = 0.15;
+
+// The number of consecutive outliers after which the refresh rate is assumed
+// to have changed.
+constexpr int kModeChangeSampleCount = 3;
+
+// Sequence gaps larger than this are not trusted to count frames.
+constexpr uint32_t kMaxSequenceGap = 8;
+
+}  // namespace
+
+void VsyncPeriodEstimator::AddVblank(uint32_t sequence,
+                                     uint64_t timestamp_nanos) {
+  if (!has_last_ || timestamp_nanos <= last_timestamp_) {
+    has_last_ = true;
+    last_sequence_ = sequence;
+    last_timestamp_ = timestamp_nanos;
+    return;
+  }
+
+  const double interval = timestamp_nanos - last_timestamp_;
+  uint32_t frames = sequence - last_sequence_;
+  if (frames == 0 || frames > kMaxSequenceGap) {
+    frames = static_cast<uint32_t>(
+        std::max(1.0, std::round(interval / period_)));
+  }
+  last_sequence_ = sequence;
+  last_timestamp_ = timestamp_nanos;
+
+  const double sample = interval / frames;
+  if (sample < kMinPeriodNanos || sample > kMaxPeriodNanos) {
+    return;
+  }
+
+  if (sample_count_ == 0) {
+    period_ = sample;
+  } else if (std::abs(sample - period_) > period_ * kOutlierThreshold) {
+    if (++outlier_count_ < kModeChangeSampleCount) {
+      return;
+    }
+    period_ = sample;
+  } else {
+    period_ += (sample - period_) * kSmoothingFactor;
+  }
+  outlier_count_ = 0;
+  sample_count_++;
+}
+
+void VsyncPeriodEstimator::Reset() {
+  has_last_ = false;
+  last_sequence_ = 0;
+  last_timestamp_ = 0;
+  period_ = kDefaultPeriodNanos;
+  sample_count_ = 0;
+  outlier_count_ = 0;
+}
+
+}  // namespace flutter
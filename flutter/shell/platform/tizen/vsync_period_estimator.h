@@ -0,0 +1,54 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_VSYNC_PERIOD_ESTIMATOR_H_
+#define EMBEDDER_VSYNC_PERIOD_ESTIMATOR_H_
+
+#include <cstdint>
+
+namespace flutter {
+
+// Keeps a running estimate of the display refresh period from a series of
+// vblank timestamps.
+//
+// Small deviations are smoothed out, while a sustained change (such as a
+// switch between 50Hz, 60Hz and 120Hz modes) is adopted after a few frames.
+// This class is not thread safe.
+class VsyncPeriodEstimator {
+ public:
+  // The period reported until enough vblanks have been observed.
+  static constexpr uint64_t kDefaultPeriodNanos = 16666667;
+
+  VsyncPeriodEstimator() = default;
+
+  // Adds the vblank numbered |sequence| that occurred at |timestamp_nanos|.
+  void AddVblank(uint32_t sequence, uint64_t timestamp_nanos);
+
+  // Returns the estimated refresh period.
+  uint64_t period_nanos() const { return static_cast<uint64_t>(period_); }
+
+  // Returns the timestamp of the most recent vblank, or 0 if none.
+  uint64_t last_vblank_nanos() const { return last_timestamp_; }
+
+  // Returns true once at least one interval has been measured.
+  bool has_estimate() const { return sample_count_ > 0; }
+
+  // Forgets all observed vblanks.
+  void Reset();
+
+ private:
+  bool has_last_ = false;
+  uint32_t last_sequence_ = 0;
+  uint64_t last_timestamp_ = 0;
+
+  double period_ = kDefaultPeriodNanos;
+  uint64_t sample_count_ = 0;
+
+  // The number of consecutive samples far from |period_|.
+  int outlier_count_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_VSYNC_PERIOD_ESTIMATOR_H_
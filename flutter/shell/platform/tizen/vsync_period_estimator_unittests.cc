@@ -0,0 +1,92 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/vsync_period_estimator.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+// Feeds |count| vblanks with the given |period_nanos| to |estimator|,
+// continuing from |*sequence| and |*timestamp|.
+void FeedVblanks(VsyncPeriodEstimator* estimator,
+                 uint64_t period_nanos,
+                 int count,
+                 uint32_t* sequence,
+                 uint64_t* timestamp) {
+  for (int i = 0; i < count; i++) {
+    *sequence += 1;
+    *timestamp += period_nanos;
+    estimator->AddVblank(*sequence, *timestamp);
+  }
+}
+
+}  // namespace
+
+TEST(VsyncPeriodEstimatorTest, DefaultPeriod) {
+  VsyncPeriodEstimator estimator;
+  EXPECT_FALSE(estimator.has_estimate());
+  EXPECT_EQ(estimator.period_nanos(),
+            VsyncPeriodEstimator::kDefaultPeriodNanos);
+}
+
+TEST(VsyncPeriodEstimatorTest, MeasuresCommonRefreshRates) {
+  const uint64_t periods[] = {20000000, 16666667, 8333333};
+  for (uint64_t period : periods) {
+    VsyncPeriodEstimator estimator;
+    uint32_t sequence = 100;
+    uint64_t timestamp = 1000000000;
+    FeedVblanks(&estimator, period, 10, &sequence, &timestamp);
+    EXPECT_TRUE(estimator.has_estimate());
+    EXPECT_NEAR(estimator.period_nanos(), period, 1000);
+    EXPECT_EQ(estimator.last_vblank_nanos(), timestamp);
+  }
+}
+
+TEST(VsyncPeriodEstimatorTest, SkippedVblanksAreDivided) {
+  VsyncPeriodEstimator estimator;
+  uint32_t sequence = 0;
+  uint64_t timestamp = 1000000000;
+  FeedVblanks(&estimator, 16666667, 5, &sequence, &timestamp);
+
+  // The app was idle for three frames.
+  sequence += 3;
+  timestamp += 3 * 16666667ull;
+  estimator.AddVblank(sequence, timestamp);
+  EXPECT_NEAR(estimator.period_nanos(), 16666667, 1000);
+}
+
+TEST(VsyncPeriodEstimatorTest, FollowsRefreshRateChange) {
+  VsyncPeriodEstimator estimator;
+  uint32_t sequence = 0;
+  uint64_t timestamp = 1000000000;
+  FeedVblanks(&estimator, 16666667, 10, &sequence, &timestamp);
+
+  // A single late vblank is ignored.
+  FeedVblanks(&estimator, 20000000, 1, &sequence, &timestamp);
+  EXPECT_NEAR(estimator.period_nanos(), 16666667, 1000);
+
+  // A sustained change is adopted.
+  FeedVblanks(&estimator, 20000000, 5, &sequence, &timestamp);
+  EXPECT_NEAR(estimator.period_nanos(), 20000000, 1000);
+}
+
+TEST(VsyncPeriodEstimatorTest, Reset) {
+  VsyncPeriodEstimator estimator;
+  uint32_t sequence = 0;
+  uint64_t timestamp = 1000000000;
+  FeedVblanks(&estimator, 8333333, 10, &sequence, &timestamp);
+
+  estimator.Reset();
+  EXPECT_FALSE(estimator.has_estimate());
+  EXPECT_EQ(estimator.period_nanos(),
+            VsyncPeriodEstimator::kDefaultPeriodNanos);
+  EXPECT_EQ(estimator.last_vblank_nanos(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
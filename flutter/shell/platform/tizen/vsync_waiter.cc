@@ -0,0 +1,45 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/vsync_waiter.h"
+
+#include <cmath>
+#include <utility>
+
+namespace flutter {
+
+namespace {
+
+// The relative change of the refresh period that is reported. This is well
+// below the gap between any two common display modes (e.g. 48 and 50Hz).
+constexpr double kPeriodChangeThreshold = 0.03;
+
+}  // namespace
+
+void VsyncWaiter::SetPeriodChangedCallback(
+    std::function<void(uint64_t period_nanos)> callback) {
+  std::lock_guard<std::mutex> lock(period_mutex_);
+  period_changed_callback_ = std::move(callback);
+}
+
+void VsyncWaiter::ReportPeriod(uint64_t period_nanos) {
+  std::function<void(uint64_t)> callback;
+  {
+    std::lock_guard<std::mutex> lock(period_mutex_);
+    if (reported_period_nanos_ != 0) {
+      double delta = std::abs(static_cast<double>(period_nanos) -
+                              static_cast<double>(reported_period_nanos_));
+      if (delta <= reported_period_nanos_ * kPeriodChangeThreshold) {
+        return;
+      }
+    }
+    reported_period_nanos_ = period_nanos;
+    callback = period_changed_callback_;
+  }
+  if (callback) {
+    callback(period_nanos);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,63 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_VSYNC_WAITER_H_
+#define EMBEDDER_VSYNC_WAITER_H_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace flutter {
+
+// The source of vsync signals for an engine.
+enum class VsyncSource {
+  // No vsync callback is installed; the engine uses its internal timing.
+  kNone,
+  // Vblank events of the display, delivered by TDM.
+  kTdm,
+  // A software timer ticking at the display refresh period.
+  kTimer,
+};
+
+// Notifies the engine of the vsync that |baton| was waiting for.
+using VsyncCallback = std::function<void(intptr_t baton,
+                                         uint64_t frame_start_time_nanos,
+                                         uint64_t frame_target_time_nanos)>;
+
+// An interface for objects that notify the engine of vsync events.
+class VsyncWaiter {
+ public:
+  virtual ~VsyncWaiter() = default;
+
+  // Requests the engine to be notified with |baton| at the next vsync.
+  // May be called from any thread.
+  virtual void AsyncWaitForVsync(intptr_t baton) = 0;
+
+  // Returns the current refresh period.
+  virtual uint64_t GetVsyncPeriodNanos() const = 0;
+
+  // Returns the time of the most recent vsync, or 0 if there was none yet.
+  virtual uint64_t GetLastVsyncNanos() const = 0;
+
+  // Sets a callback to be invoked when the refresh period changes. The
+  // callback is invoked on the vsync thread.
+  void SetPeriodChangedCallback(
+      std::function<void(uint64_t period_nanos)> callback);
+
+ protected:
+  // Invokes the period changed callback if |period_nanos| differs noticeably
+  // from the last reported period. Small fluctuations of the measured period
+  // are not reported.
+  void ReportPeriod(uint64_t period_nanos);
+
+ private:
+  std::function<void(uint64_t)> period_changed_callback_;
+  uint64_t reported_period_nanos_ = 0;
+  std::mutex period_mutex_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_VSYNC_WAITER_H_
@@ -0,0 +1,393 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/tizen/yuv_converter.h"
+
+#include <GLES2/gl2ext.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "flutter/shell/platform/tizen/logger.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr GLuint kPositionLocation = 0;
+
+constexpr char kVertexShader[] = R"(
+attribute vec2 a_position;
+varying vec2 v_tex_coord;
+void main() {
+  gl_Position = vec4(a_position, 0.0, 1.0);
+  v_tex_coord = a_position * 0.5 + 0.5;
+}
+)";
+
+// BT.601 limited range.
+constexpr char kFragmentShaderHeader[] = R"(
+precision mediump float;
+varying vec2 v_tex_coord;
+vec4 YuvToRgba(float y, float u, float v) {
+  y = 1.164383 * (y - 0.062745);
+  u -= 0.501961;
+  v -= 0.501961;
+  vec3 rgb = vec3(y + 1.596027 * v,
+                  y - 0.391762 * u - 0.812968 * v,
+                  y + 2.017232 * u);
+  return vec4(clamp(rgb, 0.0, 1.0), 1.0);
+}
+)";
+
+// The UV plane is uploaded as luminance-alpha, so U is read from the red
+// channel and V from the alpha channel.
+constexpr char kNv12FragmentShader[] = R"(
+uniform sampler2D u_y_texture;
+uniform sampler2D u_u_texture;
+void main() {
+  vec4 uv = texture2D(u_u_texture, v_tex_coord);
+  gl_FragColor =
+      YuvToRgba(texture2D(u_y_texture, v_tex_coord).r, uv.r, uv.a);
+}
+)";
+
+constexpr char kI420FragmentShader[] = R"(
+uniform sampler2D u_y_texture;
+uniform sampler2D u_u_texture;
+uniform sampler2D u_v_texture;
+void main() {
+  gl_FragColor = YuvToRgba(texture2D(u_y_texture, v_tex_coord).r,
+                           texture2D(u_u_texture, v_tex_coord).r,
+                           texture2D(u_v_texture, v_tex_coord).r);
+}
+)";
+
+// A quad covering the viewport, drawn as a triangle strip.
+constexpr GLfloat kPositions[] = {-1.0f, -1.0f, 1.0f, -1.0f,
+                                  -1.0f, 1.0f,  1.0f, 1.0f};
+
+GLuint CompileShader(GLenum type, const char* header, const char* source) {
+  const char* sources[] = {header, source};
+  GLuint shader = glCreateShader(type);
+  glShaderSource(shader, 2, sources, nullptr);
+  glCompileShader(shader);
+  GLint compiled = GL_FALSE;
+  glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+  if (compiled != GL_TRUE) {
+    char log[512] = {};
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    FT_LOG(Error) << "Could not compile a YUV conversion shader: " << log;
+    glDeleteShader(shader);
+    return 0;
+  }
+  return shader;
+}
+
+// Saves the GL state changed by a conversion and restores it when
+// destroyed. Per-fragment operations that would affect the conversion are
+// disabled in the meantime.
+class ScopedGLState {
+ public:
+  ScopedGLState() {
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer_);
+    glGetIntegerv(GL_VIEWPORT, viewport_);
+    glGetIntegerv(GL_CURRENT_PROGRAM, &program_);
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &active_texture_);
+    for (GLint i = 0; i < kTextureUnitCount; i++) {
+      glActiveTexture(GL_TEXTURE0 + i);
+      glGetIntegerv(GL_TEXTURE_BINDING_2D, &textures_[i]);
+    }
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &array_buffer_);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpack_alignment_);
+    glGetVertexAttribiv(kPositionLocation, GL_VERTEX_ATTRIB_ARRAY_ENABLED,
+                        &attrib_enabled_);
+    glGetVertexAttribiv(kPositionLocation,
+                        GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &attrib_buffer_);
+    glGetVertexAttribiv(kPositionLocation, GL_VERTEX_ATTRIB_ARRAY_SIZE,
+                        &attrib_size_);
+    glGetVertexAttribiv(kPositionLocation, GL_VERTEX_ATTRIB_ARRAY_TYPE,
+                        &attrib_type_);
+    glGetVertexAttribiv(kPositionLocation, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED,
+                        &attrib_normalized_);
+    glGetVertexAttribiv(kPositionLocation, GL_VERTEX_ATTRIB_ARRAY_STRIDE,
+                        &attrib_stride_);
+    glGetVertexAttribPointerv(kPositionLocation,
+                              GL_VERTEX_ATTRIB_ARRAY_POINTER, &attrib_pointer_);
+    for (size_t i = 0; i < kCapabilityCount; i++) {
+      capabilities_[i] = glIsEnabled(kCapabilities[i]);
+      glDisable(kCapabilities[i]);
+    }
+    glGetBooleanv(GL_COLOR_WRITEMASK, color_mask_);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+  }
+
+  ~ScopedGLState() {
+    glColorMask(color_mask_[0], color_mask_[1], color_mask_[2],
+                color_mask_[3]);
+    for (size_t i = 0; i < kCapabilityCount; i++) {
+      if (capabilities_[i]) {
+        glEnable(kCapabilities[i]);
+      }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, attrib_buffer_);
+    glVertexAttribPointer(kPositionLocation, attrib_size_, attrib_type_,
+                          attrib_normalized_, attrib_stride_, attrib_pointer_);
+    if (attrib_enabled_) {
+      glEnableVertexAttribArray(kPositionLocation);
+    } else {
+      glDisableVertexAttribArray(kPositionLocation);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, array_buffer_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, unpack_alignment_);
+    for (GLint i = 0; i < kTextureUnitCount; i++) {
+      glActiveTexture(GL_TEXTURE0 + i);
+      glBindTexture(GL_TEXTURE_2D, textures_[i]);
+    }
+    glActiveTexture(active_texture_);
+    glUseProgram(program_);
+    glViewport(viewport_[0], viewport_[1], viewport_[2], viewport_[3]);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+  }
+
+ private:
+  static constexpr GLint kTextureUnitCount = 3;
+  static constexpr size_t kCapabilityCount = 5;
+  static constexpr GLenum kCapabilities[kCapabilityCount] = {
+      GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_SCISSOR_TEST,
+      GL_STENCIL_TEST};
+
+  GLint framebuffer_ = 0;
+  GLint viewport_[4] = {};
+  GLint program_ = 0;
+  GLint active_texture_ = GL_TEXTURE0;
+  GLint textures_[kTextureUnitCount] = {};
+  GLint array_buffer_ = 0;
+  GLint unpack_alignment_ = 4;
+  GLint attrib_enabled_ = GL_FALSE;
+  GLint attrib_buffer_ = 0;
+  GLint attrib_size_ = 4;
+  GLint attrib_type_ = GL_FLOAT;
+  GLint attrib_normalized_ = GL_FALSE;
+  GLint attrib_stride_ = 0;
+  void* attrib_pointer_ = nullptr;
+  GLboolean capabilities_[kCapabilityCount] = {};
+  GLboolean color_mask_[4] = {};
+};
+
+}  // namespace
+
+YuvConverter::YuvConverter(bool has_unpack_subimage)
+    : has_unpack_subimage_(has_unpack_subimage) {}
+
+YuvConverter::~YuvConverter() {
+  for (const Program& program : {nv12_program_, i420_program_}) {
+    if (program.program != 0) {
+      glDeleteProgram(program.program);
+    }
+  }
+  for (Plane& plane : planes_) {
+    if (plane.texture != 0) {
+      glDeleteTextures(1, &plane.texture);
+    }
+  }
+}
+
+bool YuvConverter::IsYuvFormat(FlutterDesktopPixelFormat format) {
+  return format == kFlutterDesktopPixelFormatNV12 ||
+         format == kFlutterDesktopPixelFormatI420;
+}
+
+bool YuvConverter::Convert(const FlutterDesktopPixelBuffer& pixel_buffer,
+                           size_t row_bytes,
+                           GLuint texture) {
+  const bool is_nv12 = pixel_buffer.format == kFlutterDesktopPixelFormatNV12;
+  const size_t width = pixel_buffer.width;
+  const size_t height = pixel_buffer.height;
+  const size_t chroma_width = (width + 1) / 2;
+  const size_t chroma_height = (height + 1) / 2;
+
+  // NV12 has a single chroma plane of two bytes per sample.
+  const size_t chroma_plane_count = is_nv12 ? 1 : 2;
+  const size_t min_chroma_row_bytes = is_nv12 ? chroma_width * 2 : chroma_width;
+  const size_t default_chroma_row_bytes =
+      std::max(is_nv12 ? row_bytes : (row_bytes + 1) / 2, min_chroma_row_bytes);
+  const bool is_contiguous = pixel_buffer.chroma_planes[0] == nullptr;
+
+  const uint8_t* chroma_planes[2] = {};
+  size_t chroma_row_bytes[2] = {};
+  const uint8_t* next_plane = pixel_buffer.buffer + row_bytes * height;
+  for (size_t i = 0; i < chroma_plane_count; i++) {
+    chroma_row_bytes[i] = pixel_buffer.chroma_row_bytes[i];
+    if (chroma_row_bytes[i] == 0) {
+      chroma_row_bytes[i] = default_chroma_row_bytes;
+    } else if (chroma_row_bytes[i] < min_chroma_row_bytes) {
+      FT_LOG(Error) << "Invalid chroma row bytes " << chroma_row_bytes[i]
+                    << " for a pixel buffer of width " << width << ".";
+      return false;
+    }
+    chroma_planes[i] =
+        is_contiguous ? next_plane : pixel_buffer.chroma_planes[i];
+    if (!chroma_planes[i]) {
+      FT_LOG(Error) << "Missing chroma plane " << i << " of a pixel buffer.";
+      return false;
+    }
+    next_plane = chroma_planes[i] + chroma_row_bytes[i] * chroma_height;
+  }
+
+  ScopedGLState state;
+
+  const Program* program = GetProgram(pixel_buffer.format);
+  if (!program) {
+    return false;
+  }
+
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glActiveTexture(GL_TEXTURE0);
+  UploadPlane(&planes_[0], GL_LUMINANCE, pixel_buffer.buffer, row_bytes,
+              width, height);
+  glActiveTexture(GL_TEXTURE1);
+  UploadPlane(&planes_[1], is_nv12 ? GL_LUMINANCE_ALPHA : GL_LUMINANCE,
+              chroma_planes[0], chroma_row_bytes[0], chroma_width,
+              chroma_height);
+  if (!is_nv12) {
+    glActiveTexture(GL_TEXTURE2);
+    UploadPlane(&planes_[2], GL_LUMINANCE, chroma_planes[1],
+                chroma_row_bytes[1], chroma_width, chroma_height);
+  }
+
+  // Framebuffers are not shared between contexts, so one is created for each
+  // conversion rather than kept alive with a context that may not be current
+  // when this object is destroyed.
+  GLuint framebuffer = 0;
+  glGenFramebuffers(1, &framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                         texture, 0);
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    FT_LOG(Error) << "Could not create a YUV conversion framebuffer: "
+                  << status;
+    glDeleteFramebuffers(1, &framebuffer);
+    return false;
+  }
+
+  glViewport(0, 0, width, height);
+  glUseProgram(program->program);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glVertexAttribPointer(kPositionLocation, 2, GL_FLOAT, GL_FALSE, 0,
+                        kPositions);
+  glEnableVertexAttribArray(kPositionLocation);
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+  glDeleteFramebuffers(1, &framebuffer);
+  return true;
+}
+
+const YuvConverter::Program* YuvConverter::GetProgram(
+    FlutterDesktopPixelFormat format) {
+  const bool is_nv12 = format == kFlutterDesktopPixelFormatNV12;
+  Program* program = is_nv12 ? &nv12_program_ : &i420_program_;
+  if (program->program != 0) {
+    return program;
+  }
+
+  GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, "", kVertexShader);
+  GLuint fragment_shader =
+      CompileShader(GL_FRAGMENT_SHADER, kFragmentShaderHeader,
+                    is_nv12 ? kNv12FragmentShader : kI420FragmentShader);
+  if (vertex_shader == 0 || fragment_shader == 0) {
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+    return nullptr;
+  }
+
+  GLuint name = glCreateProgram();
+  glAttachShader(name, vertex_shader);
+  glAttachShader(name, fragment_shader);
+  glBindAttribLocation(name, kPositionLocation, "a_position");
+  glLinkProgram(name);
+  glDeleteShader(vertex_shader);
+  glDeleteShader(fragment_shader);
+
+  GLint linked = GL_FALSE;
+  glGetProgramiv(name, GL_LINK_STATUS, &linked);
+  if (linked != GL_TRUE) {
+    char log[512] = {};
+    glGetProgramInfoLog(name, sizeof(log), nullptr, log);
+    FT_LOG(Error) << "Could not link the YUV conversion program: " << log;
+    glDeleteProgram(name);
+    return nullptr;
+  }
+
+  program->program = name;
+  program->y_location = glGetUniformLocation(name, "u_y_texture");
+  program->u_location = glGetUniformLocation(name, "u_u_texture");
+  program->v_location = glGetUniformLocation(name, "u_v_texture");
+
+  // Uniforms are part of the program object, so they only need to be set
+  // once.
+  glUseProgram(name);
+  glUniform1i(program->y_location, 0);
+  glUniform1i(program->u_location, 1);
+  if (program->v_location >= 0) {
+    glUniform1i(program->v_location, 2);
+  }
+  return program;
+}
+
+void YuvConverter::UploadPlane(Plane* plane,
+                               GLenum format,
+                               const uint8_t* data,
+                               size_t row_bytes,
+                               size_t width,
+                               size_t height) {
+  const size_t bytes_per_sample = format == GL_LUMINANCE_ALPHA ? 2 : 1;
+  const size_t plane_row_bytes = width * bytes_per_sample;
+
+  bool reallocate = plane->texture == 0 || plane->format != format ||
+                    plane->width != width || plane->height != height;
+  if (plane->texture == 0) {
+    glGenTextures(1, &plane->texture);
+    glBindTexture(GL_TEXTURE_2D, plane->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  } else {
+    glBindTexture(GL_TEXTURE_2D, plane->texture);
+  }
+  plane->format = format;
+  plane->width = width;
+  plane->height = height;
+
+  const uint8_t* pixels = data;
+  bool has_row_length = false;
+  if (row_bytes != plane_row_bytes) {
+    if (has_unpack_subimage_ && row_bytes % bytes_per_sample == 0) {
+      glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, row_bytes / bytes_per_sample);
+      has_row_length = true;
+    } else {
+      staging_buffer_.resize(plane_row_bytes * height);
+      for (size_t row = 0; row < height; row++) {
+        memcpy(staging_buffer_.data() + row * plane_row_bytes,
+               data + row * row_bytes, plane_row_bytes);
+      }
+      pixels = staging_buffer_.data();
+    }
+  }
+
+  if (reallocate) {
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format,
+                 GL_UNSIGNED_BYTE, pixels);
+  } else {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format,
+                    GL_UNSIGNED_BYTE, pixels);
+  }
+  if (has_row_length) {
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,87 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef EMBEDDER_YUV_CONVERTER_H_
+#define EMBEDDER_YUV_CONVERTER_H_
+
+#include <GLES2/gl2.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "flutter/shell/platform/common/public/flutter_texture_registrar.h"
+
+namespace flutter {
+
+// Converts YUV 4:2:0 pixel buffers into RGBA textures on the GPU.
+//
+// The planes are uploaded into luminance textures and drawn into the target
+// texture with a shader, which uploads less than half the data of an RGBA
+// buffer of the same size. The GL state touched by a conversion is
+// restored, so it can run on the context that the engine renders with.
+class YuvConverter {
+ public:
+  // |has_unpack_subimage| is whether GL_EXT_unpack_subimage is supported by
+  // the context that conversions run on.
+  explicit YuvConverter(bool has_unpack_subimage);
+
+  // Must be destroyed with a context of the same share group current.
+  ~YuvConverter();
+
+  // Prevent copying.
+  YuvConverter(const YuvConverter&) = delete;
+  YuvConverter& operator=(const YuvConverter&) = delete;
+
+  static bool IsYuvFormat(FlutterDesktopPixelFormat format);
+
+  // Converts |pixel_buffer| into |texture|, which must have RGBA storage of
+  // the size of |pixel_buffer|. |row_bytes| is the distance between rows of
+  // the Y plane.
+  bool Convert(const FlutterDesktopPixelBuffer& pixel_buffer,
+               size_t row_bytes,
+               GLuint texture);
+
+ private:
+  struct Program {
+    GLuint program = 0;
+    GLint y_location = -1;
+    GLint u_location = -1;
+    GLint v_location = -1;
+  };
+
+  // A texture holding a plane of samples.
+  struct Plane {
+    GLuint texture = 0;
+    GLenum format = GL_NONE;
+    size_t width = 0;
+    size_t height = 0;
+  };
+
+  // Returns the program for |format|, compiling it on first use.
+  const Program* GetProgram(FlutterDesktopPixelFormat format);
+
+  // Uploads |width| x |height| samples of |format| into |plane|.
+  void UploadPlane(Plane* plane,
+                   GLenum format,
+                   const uint8_t* data,
+                   size_t row_bytes,
+                   size_t width,
+                   size_t height);
+
+  bool has_unpack_subimage_ = false;
+
+  Program nv12_program_;
+  Program i420_program_;
+  // Y, U (or UV) and V planes.
+  Plane planes_[3];
+
+  // Rows of a plane repacked for upload if GL_EXT_unpack_subimage is not
+  // supported.
+  std::vector<uint8_t> staging_buffer_;
+};
+
+}  // namespace flutter
+
+#endif  // EMBEDDER_YUV_CONVERTER_H_